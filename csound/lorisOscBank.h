@@ -0,0 +1,133 @@
+#ifndef INCLUDE_LORISOSCBANK_H
+#define INCLUDE_LORISOSCBANK_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ *	lorisOscBank.h
+ *
+ *	Definition of class OscillatorBank, the block synthesis engine shared
+ *	by the lorisplay unit generators in lorisgens4 and lorisgens5.
+ *
+ *	OscillatorBank does not depend on Csound, so it can be built and
+ *	exercised without the Csound headers.
+ *
+ */
+
+#include "Filter.h"
+#include "NoiseGenerator.h"
+
+#include <cstddef>
+#include <vector>
+
+//	begin namespace
+namespace Loris {
+
+// ---------------------------------------------------------------------------
+//	class OscillatorBank
+//
+//!	OscillatorBank renders a fixed number of bandwidth-enhanced
+//!	oscillators one control block at a time. It produces the same
+//!	oscillation as a vector of Oscillator, each one driven by
+//!	Oscillator::oscillate, but keeps the oscillator state in
+//!	struct-of-arrays form, so that the per-sample loop runs over
+//!	contiguous lanes of oscillators that the compiler can vectorize.
+//!
+//!	Each control block, the client sets the target envelope parameters
+//!	of every oscillator with setTarget, then calls render to accumulate
+//!	one block of samples. Oscillators that are silent and remain silent
+//!	(zero current and target amplitude) are never added to the active
+//!	list, and cost nothing in render.
+//!
+//!	OscillatorBank is not thread-safe; each lorisplay instance owns
+//!	its own bank.
+//
+class OscillatorBank
+{
+//	--- interface ---
+public:
+	//!	Number of oscillators rendered together in the inner sample
+	//!	loop. Partial groups are padded with silent lanes.
+	enum { LaneWidth = 4 };
+
+	//!	Construct a bank of numOscils silent oscillators rendering
+	//!	at the specified sample rate (Hz).
+	OscillatorBank( std::size_t numOscils, double srate );
+
+	//	copy, assignment, and destruction are free
+
+	//!	Return the number of oscillators in this bank.
+	std::size_t size( void ) const { return m_amp.size(); }
+
+	//!	Return the number of oscillators that will be rendered
+	//!	in the next call to render.
+	std::size_t numActive( void ) const { return m_active.size(); }
+
+	//!	Set the envelope parameters that oscillator idx should reach
+	//!	at the end of the next rendered block. Frequency is in Hz, phase
+	//!	is used only when the oscillator turns on from zero amplitude.
+	//!	The caller must ensure that idx is less than size().
+	void setTarget( std::size_t idx, double freqHz, double amp,
+					double bw, double phase );
+
+	//!	Accumulate one block of samples from all active oscillators
+	//!	into the half-open range [begin, end), and advance their
+	//!	state to the targets set since the last block. The active
+	//!	list is cleared, so setTarget must be called again for each
+	//!	oscillator before the next block.
+	void render( double * begin, double * end );
+
+//	--- implementation ---
+private:
+	void renderLanes( const std::size_t * lanes, std::size_t numLanes,
+					  bool noisy, double * begin, std::size_t nsamps );
+
+	double m_twoPiOverSR;				//	Hz to radians per sample
+
+	//	instantaneous oscillator state, one entry per oscillator:
+	std::vector< double > m_freq;		//	radians per sample
+	std::vector< double > m_amp;		//	absolute amplitude
+	std::vector< double > m_bw;			//	bandwidth coefficient
+	std::vector< double > m_phase;		//	deterministic phase in radians
+
+	//	targets for the next block (Breakpoint values):
+	std::vector< double > m_targetFreq;	//	Hz
+	std::vector< double > m_targetAmp;
+	std::vector< double > m_targetBw;
+	std::vector< double > m_targetPhase;
+
+	//	stochastic modulators, one per oscillator:
+	std::vector< NoiseGenerator > m_modulators;
+	std::vector< Filter > m_filters;
+
+	//	indices of oscillators to render in the next block:
+	std::vector< std::size_t > m_active;
+
+	//	scratch lists and noise samples, reused from block to block:
+	std::vector< std::size_t > m_pure;
+	std::vector< std::size_t > m_noisy;
+	std::vector< double > m_noise;
+
+};	//	end of class OscillatorBank
+
+}	//	end of namespace Loris
+
+#endif /* ndef INCLUDE_LORISOSCBANK_H */
@@ -0,0 +1,154 @@
+# ============================================================================
+#  http://www.gnu.org/software/autoconf-archive/ax_cxx_compile_stdcxx_17.html
+# ============================================================================
+#
+# SYNOPSIS
+#
+#   AX_CXX_COMPILE_STDCXX_17([ext|noext],[mandatory|optional])
+#
+# DESCRIPTION
+#
+#   Check for baseline language coverage in the compiler for the C++17
+#   standard; if necessary, add switches to CXXFLAGS to enable support.
+#
+#   The first argument, if specified, indicates whether you insist on an
+#   extended mode (e.g. -std=gnu++17) or a strict conformance mode (e.g.
+#   -std=c++17).  If neither is specified, you get whatever works, with
+#   preference for an extended mode.
+#
+#   The second argument, if specified 'mandatory' or if left unspecified,
+#   indicates that baseline C++17 support is required and that the macro
+#   should error out if no mode with that support is found.  If specified
+#   'optional', then configuration proceeds regardless, after defining
+#   HAVE_CXX17 if and only if a supporting mode is found.
+#
+# LICENSE
+#
+#   Copyright (c) 2008 Benjamin Kosnik <bkoz@redhat.com>
+#   Copyright (c) 2012 Zack Weinberg <zackw@panix.com>
+#   Copyright (c) 2013 Roy Stogner <roystgnr@ices.utexas.edu>
+#   Copyright (c) 2014, 2015 Google Inc.; contributed by Alexey Sokolov <sokolov@google.com>
+#
+#   Adapted for C++17 from ax_cxx_compile_stdcxx_11.m4 (serial 11) for
+#   Loris, keeping the same interface and switch search.
+#
+#   Copying and distribution of this file, with or without modification, are
+#   permitted in any medium without royalty provided the copyright notice
+#   and this notice are preserved. This file is offered as-is, without any
+#   warranty.
+
+#serial 11
+
+m4_define([_AX_CXX_COMPILE_STDCXX_17_testbody], [[
+#include <utility>
+
+  namespace test_nested::namespace_definitions {
+    struct foo {};
+  }
+
+  inline constexpr int inline_variable = 17;
+
+  template <typename... T>
+  constexpr auto fold_sum(T... t) { return (t + ... + 0); }
+
+  static_assert(fold_sum(1, 2, 3) == 6);
+
+  template <typename T>
+  constexpr int if_constexpr(T t) {
+    if constexpr (sizeof(T) > 1) {
+      return 1;
+    } else {
+      return 0;
+    }
+  }
+
+  int structured_bindings() {
+    std::pair<int, int> p(1, 2);
+    auto [a, b] = p;
+    return a + b + if_constexpr(p.first) + inline_variable;
+  }
+
+  template <typename T>
+  struct deduced {
+    deduced(T) {}
+  };
+  deduced d(42);
+]])
+
+AC_DEFUN([AX_CXX_COMPILE_STDCXX_17], [dnl
+  m4_if([$1], [], [],
+        [$1], [ext], [],
+        [$1], [noext], [],
+        [m4_fatal([invalid argument `$1' to AX_CXX_COMPILE_STDCXX_17])])dnl
+  m4_if([$2], [], [ax_cxx_compile_cxx17_required=true],
+        [$2], [mandatory], [ax_cxx_compile_cxx17_required=true],
+        [$2], [optional], [ax_cxx_compile_cxx17_required=false],
+        [m4_fatal([invalid second argument `$2' to AX_CXX_COMPILE_STDCXX_17])])
+  AC_LANG_PUSH([C++])dnl
+  ac_success=no
+  AC_CACHE_CHECK(whether $CXX supports C++17 features by default,
+  ax_cv_cxx_compile_cxx17,
+  [AC_COMPILE_IFELSE([AC_LANG_SOURCE([_AX_CXX_COMPILE_STDCXX_17_testbody])],
+    [ax_cv_cxx_compile_cxx17=yes],
+    [ax_cv_cxx_compile_cxx17=no])])
+  if test x$ax_cv_cxx_compile_cxx17 = xyes; then
+    ac_success=yes
+  fi
+
+  m4_if([$1], [noext], [], [dnl
+  if test x$ac_success = xno; then
+    for switch in -std=gnu++17 -std=gnu++1z; do
+      cachevar=AS_TR_SH([ax_cv_cxx_compile_cxx17_$switch])
+      AC_CACHE_CHECK(whether $CXX supports C++17 features with $switch,
+                     $cachevar,
+        [ac_save_CXXFLAGS="$CXXFLAGS"
+         CXXFLAGS="$CXXFLAGS $switch"
+         AC_COMPILE_IFELSE([AC_LANG_SOURCE([_AX_CXX_COMPILE_STDCXX_17_testbody])],
+          [eval $cachevar=yes],
+          [eval $cachevar=no])
+         CXXFLAGS="$ac_save_CXXFLAGS"])
+      if eval test x\$$cachevar = xyes; then
+        CXXFLAGS="$CXXFLAGS $switch"
+        ac_success=yes
+        break
+      fi
+    done
+  fi])
+
+  m4_if([$1], [ext], [], [dnl
+  if test x$ac_success = xno; then
+    for switch in -std=c++17 -std=c++1z; do
+      cachevar=AS_TR_SH([ax_cv_cxx_compile_cxx17_$switch])
+      AC_CACHE_CHECK(whether $CXX supports C++17 features with $switch,
+                     $cachevar,
+        [ac_save_CXXFLAGS="$CXXFLAGS"
+         CXXFLAGS="$CXXFLAGS $switch"
+         AC_COMPILE_IFELSE([AC_LANG_SOURCE([_AX_CXX_COMPILE_STDCXX_17_testbody])],
+          [eval $cachevar=yes],
+          [eval $cachevar=no])
+         CXXFLAGS="$ac_save_CXXFLAGS"])
+      if eval test x\$$cachevar = xyes; then
+        CXXFLAGS="$CXXFLAGS $switch"
+        ac_success=yes
+        break
+      fi
+    done
+  fi])
+  AC_LANG_POP([C++])
+  if test x$ax_cxx_compile_cxx17_required = xtrue; then
+    if test x$ac_success = xno; then
+      AC_MSG_ERROR([*** A compiler with support for C++17 language features is required.])
+    fi
+  else
+    if test x$ac_success = xno; then
+      HAVE_CXX17=0
+      AC_MSG_NOTICE([No compiler with C++17 support was found])
+    else
+      HAVE_CXX17=1
+      AC_DEFINE(HAVE_CXX17,1,
+                [define if the compiler supports basic C++17 syntax])
+    fi
+
+    AC_SUBST(HAVE_CXX17)
+  fi
+])
@@ -509,6 +509,8 @@ void fixFrequency( Partial & partial, double maxFixPct = 0.2 );
 // ----------------------------------------------------------------
 //	Include auxiliary SWIG interface files.
 
+%include lorisArrays.i
+
 %include lorisPartialList.i
 
 %include lorisFundamental.i
@@ -90,8 +90,34 @@ instance.") Analyzer;
 "Analyze a vector of (mono) samples at the given sample rate 	  	
 (in Hz) and return the resulting Partials in a PartialList.
 If specified, use a frequency envelope as a fundamental reference for
-Partial formation.") analyze;
+Partial formation. In Python, the samples may be any sequence of
+numbers, and samples in a contiguous array of doubles (such as a
+NumPy float64 array) are analyzed in place, without copying.") analyze;
 
+#ifdef SWIGPYTHON
+		PartialList analyze( const double * samples, unsigned long numSamples,
+                             double srate )
+		{
+			PartialList partials;
+			if ( 0 != numSamples )
+			{
+				partials = self->analyze( samples, samples + numSamples, srate );
+			}
+			return partials;
+		}
+		 
+		PartialList analyze( const double * samples, unsigned long numSamples,
+                             double srate, Envelope * env )
+		{
+			PartialList partials;
+			if ( 0 != numSamples )
+			{
+				partials = self->analyze( samples, samples + numSamples, 
+                                          srate, *env );
+			}
+			return partials;
+		}
+#else
 		PartialList analyze( const std::vector< double > & vec, double srate )
 		{
 			PartialList partials;
@@ -112,6 +138,7 @@ Partial formation.") analyze;
 			}
 			return partials;
 		}
+#endif
 	}
 	
 %feature("docstring",
@@ -0,0 +1,388 @@
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ *  lorisArrays.i
+ *
+ *  SWIG interface file describing typemaps that pass arrays of samples
+ *  to and from Loris without copying them into and out of Python lists,
+ *  and functions that convert whole PartialLists to and from NumPy
+ *  structured arrays. Include this file in loris.i, before any interface
+ *  files that use the typemaps.
+ *
+ *  Arrays are accessed using the Python buffer protocol, so NumPy arrays,
+ *  array.array objects, and memoryviews can all be used. NumPy is needed
+ *  only by exportArray and importArray.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#ifdef SWIGPYTHON
+
+/* ******************** inserted C++ code ******************** */
+%{
+
+#include <Breakpoint.h>
+#include <Partial.h>
+#include <PartialList.h>
+
+#include <vector>
+
+//	One record in a structured array representing a PartialList,
+//	one per Breakpoint. Must agree with the dtype defined in
+//	_breakpointRecordType below.
+struct BreakpointRecord
+{
+	int partial;	//	index of the Partial in the PartialList
+	int label;
+	double time;
+	double frequency;
+	double amplitude;
+	double bandwidth;
+	double phase;
+};
+
+//	Return true if the struct-module format string describes
+//	a single native double.
+static bool isDoubleFormat( const char * fmt )
+{
+	if ( 0 == fmt )
+	{
+		//	unsigned bytes
+		return false;
+	}
+
+	//	skip the byte order, if native:
+#if PY_BIG_ENDIAN
+	if ( '@' == *fmt || '=' == *fmt || '>' == *fmt || '!' == *fmt )
+#else
+	if ( '@' == *fmt || '=' == *fmt || '<' == *fmt )
+#endif
+	{
+		++fmt;
+	}
+	return 'd' == fmt[0] && '\0' == fmt[1];
+}
+
+//	Obtain the samples in a Python object for reading. If the
+//	object exports a contiguous buffer of doubles, the samples
+//	are read from the buffer in place, and the buffer must be
+//	released by the caller (haveView is set to true). Otherwise,
+//	the object must be a sequence of numbers, which are copied
+//	into copy. Return false and set a Python exception if the
+//	object is neither.
+static bool getSamples( PyObject * obj, Py_buffer * view, bool & haveView,
+						std::vector< double > & copy,
+						const double * & samples, unsigned long & numSamples )
+{
+	haveView = false;
+	if ( PyObject_CheckBuffer( obj ) &&
+		 0 == PyObject_GetBuffer( obj, view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT ) )
+	{
+		if ( isDoubleFormat( view->format ) && sizeof(double) == view->itemsize )
+		{
+			haveView = true;
+			samples = (const double *) view->buf;
+			numSamples = view->len / sizeof(double);
+			return true;
+		}
+		PyBuffer_Release( view );
+	}
+	PyErr_Clear();
+
+	//	not a buffer of doubles, copy the numbers in the sequence:
+	PyObject * seq = PySequence_Fast( obj, "expected a sequence of samples" );
+	if ( 0 == seq )
+	{
+		return false;
+	}
+	const Py_ssize_t n = PySequence_Fast_GET_SIZE( seq );
+	copy.resize( n );
+	for ( Py_ssize_t i = 0; i < n; ++i )
+	{
+		copy[i] = PyFloat_AsDouble( PySequence_Fast_GET_ITEM( seq, i ) );
+	}
+	Py_DECREF( seq );
+	if ( PyErr_Occurred() )
+	{
+		return false;
+	}
+	samples = copy.empty() ? 0 : &copy.front();
+	numSamples = copy.size();
+	return true;
+}
+
+//	Obtain a contiguous buffer of itemSize-byte items exported by a
+//	Python object, writable if specified. The buffer must be released
+//	by the caller. Return false and set a Python exception if the
+//	object does not export such a buffer. If format is not 0, the
+//	format of the buffer items must be described by that function.
+static bool getBuffer( PyObject * obj, Py_buffer * view, Py_ssize_t itemSize,
+					   bool writable, bool (*format)( const char * ) = 0 )
+{
+	const int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT |
+					  ( writable ? PyBUF_WRITABLE : 0 );
+	if ( ! PyObject_CheckBuffer( obj ) ||
+		 0 != PyObject_GetBuffer( obj, view, flags ) )
+	{
+		PyErr_Clear();
+		PyErr_SetString( PyExc_TypeError, writable ?
+						 "expected a writable contiguous array" :
+						 "expected a contiguous array" );
+		return false;
+	}
+	if ( itemSize != view->itemsize || ( format && ! format( view->format ) ) )
+	{
+		PyBuffer_Release( view );
+		PyErr_SetString( PyExc_TypeError, "array has the wrong element type" );
+		return false;
+	}
+	return true;
+}
+
+//	Return true if a Python object exports a writable buffer,
+//	used for overload resolution.
+static bool isWritableBuffer( PyObject * obj )
+{
+	Py_buffer view;
+	if ( PyObject_CheckBuffer( obj ) &&
+		 0 == PyObject_GetBuffer( obj, &view, PyBUF_WRITABLE ) )
+	{
+		PyBuffer_Release( &view );
+		return true;
+	}
+	PyErr_Clear();
+	return false;
+}
+
+%}
+/* ***************** end of inserted C++ code ***************** */
+
+/* ************************* typemaps ************************** */
+
+//	Samples to be read by Loris (e.g. for analysis) may be any
+//	sequence of numbers. Contiguous arrays of doubles (float64) are
+//	read in place, other sequences are copied.
+%typemap(in) ( const double * samples, unsigned long numSamples )
+			 ( Py_buffer view, bool haveView = false, std::vector< double > copy )
+{
+	if ( ! getSamples( $input, &view, haveView, copy, $1, $2 ) )
+	{
+		SWIG_fail;
+	}
+}
+
+%typemap(freearg) ( const double * samples, unsigned long numSamples )
+{
+	if ( haveView$argnum )
+	{
+		PyBuffer_Release( &view$argnum );
+	}
+}
+
+%typemap(typecheck, precedence=SWIG_TYPECHECK_DOUBLE_ARRAY)
+	( const double * samples, unsigned long numSamples )
+{
+	$1 = ( PyObject_CheckBuffer( $input ) || PySequence_Check( $input ) ) ? 1 : 0;
+}
+
+//	Samples to be written by Loris (e.g. by synthesis) are stored
+//	in place in a writable contiguous array of doubles (float64),
+//	such as a NumPy array.
+%typemap(in) ( double * buffer, unsigned long bufferSize )
+			 ( Py_buffer view, bool haveView = false )
+{
+	if ( ! getBuffer( $input, &view, sizeof(double), true, isDoubleFormat ) )
+	{
+		SWIG_fail;
+	}
+	haveView = true;
+	$1 = (double *) view.buf;
+	$2 = view.len / sizeof(double);
+}
+
+%typemap(freearg) ( double * buffer, unsigned long bufferSize )
+{
+	if ( haveView$argnum )
+	{
+		PyBuffer_Release( &view$argnum );
+	}
+}
+
+%typemap(typecheck, precedence=SWIG_TYPECHECK_DOUBLE_ARRAY)
+	( double * buffer, unsigned long bufferSize )
+{
+	$1 = isWritableBuffer( $input ) ? 1 : 0;
+}
+
+//	Breakpoint records are exchanged with structured arrays
+//	having the dtype returned by _breakpointRecordType.
+%typemap(in) ( BreakpointRecord * records, unsigned long numRecords )
+			 ( Py_buffer view, bool haveView = false )
+{
+	if ( ! getBuffer( $input, &view, sizeof(BreakpointRecord), true ) )
+	{
+		SWIG_fail;
+	}
+	haveView = true;
+	$1 = (BreakpointRecord *) view.buf;
+	$2 = view.len / sizeof(BreakpointRecord);
+}
+
+%typemap(in) ( const BreakpointRecord * records, unsigned long numRecords )
+			 ( Py_buffer view, bool haveView = false )
+{
+	if ( ! getBuffer( $input, &view, sizeof(BreakpointRecord), false ) )
+	{
+		SWIG_fail;
+	}
+	haveView = true;
+	$1 = (const BreakpointRecord *) view.buf;
+	$2 = view.len / sizeof(BreakpointRecord);
+}
+
+%typemap(freearg) ( BreakpointRecord * records, unsigned long numRecords ),
+				  ( const BreakpointRecord * records, unsigned long numRecords )
+{
+	if ( haveView$argnum )
+	{
+		PyBuffer_Release( &view$argnum );
+	}
+}
+
+/* ******************* structured arrays ********************* */
+
+%newobject _importRecords;
+
+%inline
+%{
+	//	Return the total number of Breakpoints in all the Partials
+	//	in a PartialList, the number of records needed to represent
+	//	the PartialList.
+	unsigned long _countBreakpoints( const PartialList * partials )
+	{
+		unsigned long n = 0;
+		for ( PartialList::const_iterator it = partials->begin();
+			  it != partials->end(); ++it )
+		{
+			n += it->numBreakpoints();
+		}
+		return n;
+	}
+
+	//	Store one record for each Breakpoint in a PartialList.
+	//	There must be exactly enough records.
+	void _exportRecords( const PartialList * partials,
+						 BreakpointRecord * records, unsigned long numRecords )
+	{
+		if ( numRecords != _countBreakpoints( partials ) )
+		{
+			throw_exception( "wrong number of Breakpoint records" );
+			return;
+		}
+
+		int index = 0;
+		for ( PartialList::const_iterator it = partials->begin();
+			  it != partials->end(); ++it, ++index )
+		{
+			for ( Partial::const_iterator bp = it->begin(); bp != it->end(); ++bp )
+			{
+				records->partial = index;
+				records->label = it->label();
+				records->time = bp.time();
+				records->frequency = bp->frequency();
+				records->amplitude = bp->amplitude();
+				records->bandwidth = bp->bandwidth();
+				records->phase = bp->phase();
+				++records;
+			}
+		}
+	}
+
+	//	Return a new PartialList having one Partial for each run of
+	//	records having the same Partial index. The label of each
+	//	Partial is the label in its first record.
+	PartialList * _importRecords( const BreakpointRecord * records,
+								  unsigned long numRecords )
+	{
+		PartialList * partials = new PartialList;
+		const BreakpointRecord * end = records + numRecords;
+		while ( records != end )
+		{
+			Partial p;
+			p.setLabel( records->label );
+			const int index = records->partial;
+			for ( ; records != end && records->partial == index; ++records )
+			{
+				p.insert( records->time,
+						  Breakpoint( records->frequency, records->amplitude,
+									  records->bandwidth, records->phase ) );
+			}
+			partials->push_back( p );
+		}
+		return partials;
+	}
+%}
+
+%pythoncode
+%{
+def _breakpointRecordType():
+    import numpy
+    return numpy.dtype([('partial', numpy.intc), ('label', numpy.intc),
+                        ('time', numpy.double), ('frequency', numpy.double),
+                        ('amplitude', numpy.double), ('bandwidth', numpy.double),
+                        ('phase', numpy.double)])
+
+def exportArray(partials):
+    """Return a NumPy structured array having one record for each
+    Breakpoint in each Partial in a PartialList. Each record has
+    fields partial (the index of the Partial in the PartialList),
+    label, time, frequency, amplitude, bandwidth, and phase.
+    Records for the Breakpoints in a Partial are consecutive, and
+    in order of increasing time."""
+    import numpy
+    records = numpy.empty(_countBreakpoints(partials), _breakpointRecordType())
+    _exportRecords(partials, records)
+    return records
+
+def importArray(records):
+    """Return a new PartialList constructed from a NumPy structured
+    array (or anything NumPy can convert to one) having the fields
+    of the records returned by exportArray. Consecutive records
+    having the same partial index are Breakpoints in the same
+    Partial, and the label of a Partial is the label in its first
+    record."""
+    import numpy
+    dtype = _breakpointRecordType()
+    records = numpy.asarray(records)
+    if records.dtype != dtype or not records.flags.c_contiguous:
+        # copy fields by name, structured assignment is by position
+        converted = numpy.empty(records.shape, dtype)
+        for name in dtype.names:
+            converted[name] = records[name]
+        records = converted
+    return _importRecords(records.ravel())
+%}
+
+#endif	/* SWIGPYTHON */
@@ -231,3 +231,48 @@ synthesize;
 %}
 
 
+#ifdef SWIGPYTHON
+
+%feature("docstring",
+"Synthesize Partials in a PartialList at the given sample rate, and
+add the (floating point) samples to the samples in a writable
+contiguous array of doubles (such as a NumPy float64 array), in
+place. Samples beyond the end of the array are not rendered. Return 
+the number of samples needed for the complete synthesis of all the
+Partials in the PartialList, which may exceed the length of the 
+array.
+
+If the sample rate is unspecified, the sample rate in the default 
+SynthesisParameters is used. (See loris.SynthesisParameters.)") 
+synthesize;
+
+%inline 
+%{
+	unsigned long synthesize( const PartialList * partials, 
+	                          double * buffer, unsigned long bufferSize, 
+	                          double srate )
+	{
+		//	the Synthesizer's own sample buffer is not used:
+		std::vector<double> unused;
+		try
+		{
+			Synthesizer synth( srate, unused );
+			return synth.synthesize( partials->begin(), partials->end(),
+			                         buffer, bufferSize );
+		}
+		catch ( std::exception & ex )
+		{
+			throw_exception( ex.what() );
+		}
+		return 0;
+	}
+
+	unsigned long synthesize( const PartialList * partials, 
+	                          double * buffer, unsigned long bufferSize )
+	{
+		return synthesize( partials, buffer, bufferSize, 
+		                   Synthesizer::DefaultParameters().sampleRate );
+	}
+%}
+
+#endif	/* SWIGPYTHON */
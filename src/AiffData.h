@@ -244,6 +244,17 @@ std::istream &readInstrumentData(std::istream &s, InstrumentCk &ck,
 std::istream &readMarkerData(std::istream &s, MarkerCk &ck,
                              unsigned long chunkSize);
 
+// ---------------------------------------------------------------------------
+//	readSoundDataHeader
+// ---------------------------------------------------------------------------
+//	Read the offset and block size in the Sound Data chunk, assume the
+//	stream is correctly positioned, and that the chunk header has already
+//	been read. Skip ahead to the first sample, and return the number of
+//	bytes of sample data in the chunk. The samples are not read.
+//
+unsigned long readSoundDataHeader(std::istream &s, SoundDataCk &ck,
+                                  unsigned long chunkSize);
+
 // ---------------------------------------------------------------------------
 //	readSampleData
 // ---------------------------------------------------------------------------
@@ -324,6 +335,18 @@ std::ostream &writeSampleData(std::ostream &s, const SoundDataCk &ck);
 void convertBytesToSamples(const std::vector<Byte> &bytes,
                            std::vector<double> &samples, unsigned int bps);
 
+// ---------------------------------------------------------------------------
+//	convertBytesToSamples
+// ---------------------------------------------------------------------------
+//	Convert howMany big-endian samples of the specified size (8, 16, 24,
+//	or 32 bits) to double precision floating point samples (-1.0, 1.0),
+//	and store them in the buffer beginning at samples, which must have
+//	room for them all. Throw InvalidArgument if the sample size is not
+//	one of those.
+//
+void convertBytesToSamples(const Byte *bytes, unsigned long howMany,
+                           unsigned int bps, double *samples);
+
 // ---------------------------------------------------------------------------
 //	convertSamplesToBytes
 // ---------------------------------------------------------------------------
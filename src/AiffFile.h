@@ -22,7 +22,9 @@
  *
  * AiffFile.h
  *
- * Definition of AiffFile class for sample import and export in Loris.
+ * Definition of AiffFile class for sample import and export in Loris,
+ * and of AiffReader, for reading ranges of samples from a memory-mapped
+ * AIFF file.
  *
  * Kelly Fitz, 8 Jan 2003
  * loris@cerlsoundgroup.org
@@ -44,6 +46,7 @@
 //  begin namespace
 namespace Loris {
 
+class MappedFile;
 class Partial;
 
 // ---------------------------------------------------------------------------
@@ -302,6 +305,94 @@ private:
 
 }; //  end of class AiffFile
 
+// ---------------------------------------------------------------------------
+//  class AiffReader
+//
+//! Class AiffReader provides read-only random access to the sample
+//! data in a monaural AIFF-format samples file. The file is mapped
+//! into memory, and only the chunk headers, Markers, and Instrument
+//! data are decoded when the reader is constructed. Samples are
+//! converted from the file's integer format on demand, directly into
+//! a caller's buffer, so that a short range of sample frames can be
+//! read from a very large file without converting (or allocating
+//! storage for) the rest.
+//!
+//! AiffReader cannot be copied. Several threads may read the same
+//! AiffReader at once.
+//
+class AiffReader {
+  //  -- public interface --
+public:
+  //  -- types --
+
+  //! The type of all size parameters for AiffReader.
+  typedef AiffFile::size_type size_type;
+
+  //! The type of AIFF marker storage in an AiffReader.
+  typedef AiffFile::markers_type markers_type;
+
+  //  -- construction --
+
+  //! Initialize an instance of AiffReader for the AIFF samples file
+  //! having the specified filename or path.
+  //!
+  //! \param filename is the name or path of an AIFF samples file
+  //! \throw FileIOException if the file cannot be read, or is not a
+  //!        monaural AIFF samples file having 8, 16, 24, or 32 bit samples.
+  explicit AiffReader(const std::string &filename);
+
+  //! Destroy this AiffReader, unmapping the file.
+  ~AiffReader(void);
+
+  //  -- access --
+
+  //! Return the number of bits per sample (8, 16, 24, or 32) in
+  //! the file.
+  unsigned int bitsPerSample(void) const { return mBitsPerSample; }
+
+  //! Return a const reference to the Markers (see Marker.h) stored
+  //! in the file.
+  const markers_type &markers(void) const { return mMarkers; }
+
+  //! Return the fractional MIDI note number stored in the file.
+  //! If the file has no Instrument data, note number 60.0 is used.
+  double midiNoteNumber(void) const { return mNoteNum; }
+
+  //! Return the number of sample frames stored in the file.
+  size_type numFrames(void) const { return mNumFrames; }
+
+  //! Return the sampling freqency in Hz for the sample data in
+  //! the file.
+  double sampleRate(void) const { return mRate; }
+
+  //  -- import --
+
+  //! Convert at most howMany sample frames, beginning with the frame
+  //! at position firstFrame, to floating-point samples [-1.0, 1.0]
+  //! and store them in the buffer beginning at dst. Return the number
+  //! of frames stored, fewer than howMany (possibly zero) if the
+  //! file ends before the last requested frame.
+  //!
+  //! \param firstFrame is the position of the first frame to read
+  //! \param howMany is the number of frames to read
+  //! \param dst is a buffer having room for at least howMany samples
+  size_type read(size_type firstFrame, size_type howMany, double *dst) const;
+
+private:
+  //  -- implementation --
+  std::unique_ptr<MappedFile> mFile; // the mapped samples file
+  const unsigned char *mSampleBytes; // the first byte of sample data
+  size_type mNumFrames;
+  unsigned int mBitsPerSample;
+  double mRate, mNoteNum;
+  markers_type mMarkers;
+
+  //  not implemented
+  AiffReader(const AiffReader &);
+  AiffReader &operator=(const AiffReader &);
+
+}; //  end of class AiffReader
+
 // -- template members --
 
 // ---------------------------------------------------------------------------
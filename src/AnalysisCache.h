@@ -0,0 +1,207 @@
+#ifndef INCLUDE_ANALYSISCACHE_H
+#define INCLUDE_ANALYSISCACHE_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * AnalysisCache.h
+ *
+ * Definition of class AnalysisCache, an on-disk cache of Analyzer
+ * results, keyed by the analyzed samples and the Analyzer configuration.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#include "LinearEnvelope.h"
+#include "PartialList.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//	begin namespace
+namespace Loris {
+
+class Analyzer;
+
+// ---------------------------------------------------------------------------
+//	class AnalysisCache
+//
+//!	Class AnalysisCache stores the results of Analyzer analyses in a
+//!	directory, so that analyzing the same samples again with the same
+//!	Analyzer configuration returns the stored Partials instead of
+//!	repeating the analysis.
+//!
+//!	Each stored analysis is identified by a 128-bit hash of the samples,
+//!	the sample rate, every Analyzer parameter (including the frequency
+//!	resolution envelope and the bounds on the fundamental frequency
+//!	estimate), and the frequency reference envelope, if any. A stored
+//!	analysis includes the Partials and the amplitude and fundamental
+//!	frequency envelopes, which are restored to the Analyzer when the
+//!	stored analysis is used, so that ampEnv() and fundamentalEnv()
+//!	return the same envelopes as they would after a new analysis.
+//!
+//!	The total size of the stored analyses is bounded. When a new
+//!	analysis is stored, the least-recently used analyses are removed
+//!	until the total size is within the bound.
+//!
+//!	Several processes (and threads) may share a cache directory. Stored
+//!	analyses are written to temporary files that are renamed into place
+//!	only when they are complete, so a stored analysis is never observed
+//!	partially written, and stored analyses that cannot be read are
+//!	treated as missing.
+//
+class AnalysisCache {
+  //	-- public interface --
+public:
+  //	-- constants --
+
+  //! The default bound on the total size of the stored analyses, 1 GiB.
+  static const std::uintmax_t DefaultMaxSize = std::uintmax_t(1) << 30;
+
+  //	-- construction --
+
+  //! Construct a new AnalysisCache storing analyses in the specified
+  //! directory, which is created if it does not exist.
+  //!
+  //! \param  directory is the path of the cache directory.
+  //! \param  maxSize is the bound on the total size, in bytes, of the
+  //!         stored analyses.
+  //! \throw  FileIOException if the directory cannot be created.
+  explicit AnalysisCache(const std::string &directory,
+                         std::uintmax_t maxSize = DefaultMaxSize);
+
+  //	-- analysis --
+
+  //! Return the Partials obtained by analyzing the samples in the
+  //! specified vector at the specified sample rate using the specified
+  //! Analyzer, retrieving a stored analysis if possible, and otherwise
+  //! analyzing the samples and storing the result.
+  //!
+  //! \param  analyzer is the Analyzer to use. After analysis, its
+  //!         ampEnv() and fundamentalEnv() are available as usual.
+  //! \param  vec is a vector of floating point samples
+  //! \param  srate is the sample rate of the samples in the vector
+  PartialList analyze(Analyzer &analyzer, const std::vector<double> &vec,
+                      double srate);
+
+  //! Return the Partials obtained by analyzing the samples on the
+  //! specified (half-open) range at the specified sample rate using
+  //! the specified Analyzer, retrieving a stored analysis if possible,
+  //! and otherwise analyzing the samples and storing the result.
+  //!
+  //! \param  analyzer is the Analyzer to use.
+  //! \param  bufBegin is a pointer to a buffer of floating point samples
+  //! \param  bufEnd is (one-past) the end of a buffer of floating point
+  //!         samples
+  //! \param  srate is the sample rate of the samples in the buffer
+  PartialList analyze(Analyzer &analyzer, const double *bufBegin,
+                      const double *bufEnd, double srate);
+
+  //! Return the Partials obtained by analyzing the samples in the
+  //! specified vector at the specified sample rate using the specified
+  //! Analyzer and frequency reference envelope, retrieving a stored
+  //! analysis if possible, and otherwise analyzing the samples and
+  //! storing the result.
+  //!
+  //! The reference must be a LinearEnvelope, so that it can be
+  //! identified by its breakpoints.
+  //!
+  //! \param  analyzer is the Analyzer to use.
+  //! \param  vec is a vector of floating point samples
+  //! \param  srate is the sample rate of the samples in the vector
+  //! \param  reference is a LinearEnvelope having the approximate
+  //!         frequency contour expected of the resulting Partials.
+  PartialList analyze(Analyzer &analyzer, const std::vector<double> &vec,
+                      double srate, const LinearEnvelope &reference);
+
+  //! Return the Partials obtained by analyzing the samples on the
+  //! specified (half-open) range at the specified sample rate using
+  //! the specified Analyzer and frequency reference envelope,
+  //! retrieving a stored analysis if possible, and otherwise analyzing
+  //! the samples and storing the result.
+  //!
+  //! \param  analyzer is the Analyzer to use.
+  //! \param  bufBegin is a pointer to a buffer of floating point samples
+  //! \param  bufEnd is (one-past) the end of a buffer of floating point
+  //!         samples
+  //! \param  srate is the sample rate of the samples in the buffer
+  //! \param  reference is a LinearEnvelope having the approximate
+  //!         frequency contour expected of the resulting Partials.
+  PartialList analyze(Analyzer &analyzer, const double *bufBegin,
+                      const double *bufEnd, double srate,
+                      const LinearEnvelope &reference);
+
+  //	-- access --
+
+  //! Return the path of the cache directory.
+  const std::string &directory(void) const { return mDirectory; }
+
+  //! Return the bound on the total size, in bytes, of the stored
+  //! analyses.
+  std::uintmax_t maxSize(void) const { return mMaxSize; }
+
+  //! Return the number of analyses retrieved from the cache by this
+  //! AnalysisCache.
+  unsigned long hits(void) const { return mHits; }
+
+  //! Return the number of analyses performed (and stored) by this
+  //! AnalysisCache because no stored analysis was found.
+  unsigned long misses(void) const { return mMisses; }
+
+  //	-- mutation --
+
+  //! Set the bound on the total size, in bytes, of the stored analyses.
+  //! Stored analyses are not removed until the next analysis is stored.
+  void setMaxSize(std::uintmax_t maxSize) { mMaxSize = maxSize; }
+
+  //! Remove all stored analyses from the cache directory.
+  void clear(void);
+
+private:
+  //	-- implementation --
+  PartialList analyze(Analyzer &analyzer, const double *bufBegin,
+                      const double *bufEnd, double srate,
+                      const LinearEnvelope *reference);
+
+  bool retrieve(const std::string &key, PartialList &partials,
+                LinearEnvelope &ampEnv, LinearEnvelope &f0Env) const;
+  void store(const std::string &key, const PartialList &partials,
+             const LinearEnvelope &ampEnv, const LinearEnvelope &f0Env) const;
+  void evict(const std::string &keep) const;
+
+  std::string mDirectory;
+  std::uintmax_t mMaxSize;
+  std::atomic<unsigned long> mHits, mMisses;
+
+  //	not implemented
+  AnalysisCache(const AnalysisCache &);
+  AnalysisCache &operator=(const AnalysisCache &);
+
+}; //	end of class AnalysisCache
+
+} // namespace Loris
+
+#endif /* ndef INCLUDE_ANALYSISCACHE_H */
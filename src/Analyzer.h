@@ -42,6 +42,7 @@
 //  begin namespace
 namespace Loris {
 
+class AiffReader;
 class Envelope;
 class LinearEnvelopeBuilder;
 // class Peaks;
@@ -223,6 +224,15 @@ public:
   PartialList analyze(const double *bufBegin, const double *bufEnd,
                       double srate);
 
+  //! Analyze the (mono) samples in an AIFF samples file at the file's
+  //! sample rate and store the extracted Partials in the Analyzer's
+  //! PartialList (std::list of Partials). Samples are read from the
+  //! file as the analysis window advances, so the whole file is never
+  //! converted into memory at once.
+  //!
+  //! \param  reader is an AiffReader for the samples file
+  PartialList analyze(const AiffReader &reader);
+
   //  -- tracking analysis --
 
   //! Analyze a vector of (mono) samples at the given sample rate
@@ -251,6 +261,18 @@ public:
   PartialList analyze(const double *bufBegin, const double *bufEnd,
                       double srate, const Envelope &reference);
 
+  //! Analyze the (mono) samples in an AIFF samples file at the file's
+  //! sample rate and store the extracted Partials in the Analyzer's
+  //! PartialList (std::list of Partials). Use the specified envelope
+  //! as a frequency reference for Partial tracking. Samples are read
+  //! from the file as the analysis window advances, so the whole file
+  //! is never converted into memory at once.
+  //!
+  //! \param  reader is an AiffReader for the samples file
+  //! \param  reference is an Envelope having the approximate
+  //!         frequency contour expected of the resulting Partials.
+  PartialList analyze(const AiffReader &reader, const Envelope &reference);
+
   //  -- parameter access --
 
   //! Return the amplitude floor (lowest detected spectral amplitude),
@@ -492,6 +514,49 @@ public:
   //! during the most recent analysis performed by this Analyzer.
   const LinearEnvelope &ampEnv(void) const;
 
+  //  -- statistics --
+
+  //! Structure storing the counts and times recorded during
+  //! an analysis. Times are wall clock times in seconds, spent
+  //! in each stage of the analysis, summed over all frames.
+  //! totalTime includes the time spent in stages that are not
+  //! timed individually, like fundamental and amplitude envelope
+  //! estimation.
+  struct Stats {
+    unsigned long numFrames;        //!  short-time analysis frames
+    unsigned long numPeaksFound;    //!  spectral peaks selected
+    unsigned long numPeaksRejected; //!  peaks removed by thinning
+    unsigned long numPartialsSpawned;  //!  Partials begun
+    unsigned long numPartialsExtended; //!  peaks appended to Partials
+    unsigned long numBreakpoints;      //!  Breakpoints in all Partials
+
+    double transformTime;       //!  reassigned spectrum computation
+    double peakSelectionTime;   //!  spectral peak selection
+    double thinPeaksTime;       //!  peak thinning
+    double bandwidthTime;       //!  bandwidth envelope construction
+    double partialBuildingTime; //!  Partial formation
+    double fixFrequencyTime;    //!  frequency and phase correction
+    double totalTime;           //!  whole analysis
+
+    //! Initialize all counts and times to zero.
+    Stats(void)
+        : numFrames(0), numPeaksFound(0), numPeaksRejected(0),
+          numPartialsSpawned(0), numPartialsExtended(0), numBreakpoints(0),
+          transformTime(0), peakSelectionTime(0), thinPeaksTime(0),
+          bandwidthTime(0), partialBuildingTime(0), fixFrequencyTime(0),
+          totalTime(0) {}
+  };
+
+  //! Return the counts and times recorded during the most recent
+  //! analysis performed by this Analyzer (all zero if this Analyzer
+  //! has not analyzed anything since it was constructed, or since
+  //! resetStats was called). Recording them costs a few clock reads
+  //! per analysis frame, so they are always recorded.
+  const Stats &stats(void) const { return m_stats; }
+
+  //! Reset all the counts and times in stats() to zero.
+  void resetStats(void) { m_stats = Stats(); }
+
   //  -- legacy support --
 
   //  Fundamental and amplitude envelopes are always constructed during
@@ -553,6 +618,9 @@ private:
   //! estimate during analysis
   std::unique_ptr<LinearEnvelopeBuilder> m_ampEnvBuilder;
 
+  //! counts and times recorded during the most recent analysis
+  Stats m_stats;
+
   //  -- private auxiliary functions --
   //	future development
   /*
@@ -603,6 +671,26 @@ private:
   //  Peak bandwidth is set to zero.
   void fixBandwidth(Peaks &peaks);
 
+  //  Append to sig every value that determines the result of analyzing
+  //  numSamps samples at the sample rate srate, and replace the envelopes
+  //  built during analysis. Used by AnalysisCache to identify and restore
+  //  stored analyses.
+  friend class AnalysisCache;
+  void appendSignature(std::vector<double> &sig, long numSamps,
+                       double srate) const;
+  void restoreEnvelopes(const LinearEnvelope &ampEnv,
+                        const LinearEnvelope &f0Env);
+
+  //  Provides the samples spanned by each analysis window, from a
+  //  buffer or from an AiffReader (defined in Analyzer.C).
+  class SampleSource;
+
+  //  Analyze the samples provided by the specified SampleSource at
+  //  the given sample rate. All the public analyze members share
+  //  this implementation.
+  PartialList analyzeSamples(SampleSource &source, double srate,
+                             const Envelope &reference);
+
 }; //  end of class Analyzer
 
 } //  end of namespace Loris
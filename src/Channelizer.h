@@ -35,6 +35,7 @@
 
 #include "PartialList.h"
 
+#include <cstddef>
 #include <memory>
 
 //  begin namespace
@@ -182,6 +183,33 @@ public:
   void channelize(PartialList::iterator begin, PartialList::iterator end) const;
 #endif
 
+  //! Assign each Partial in the specified half-open (STL-style) range
+  //! the label corresponding to the frequency channel containing the
+  //! greatest portion of its (the Partial's) energy, dividing the work
+  //! among several threads.
+  //!
+  //! The reference Envelope is sampled once, at intervals of
+  //! ReferenceSampleInterval over the time span of all the Partials,
+  //! and the sampled reference is shared by all the threads, so the
+  //! reference Envelope is never evaluated concurrently. Partials are
+  //! assigned to threads in contiguous runs having approximately
+  //! equal numbers of Breakpoints.
+  //!
+  //! Because the reference is sampled, the fractional channel numbers
+  //! computed may differ slightly from those computed by channelize()
+  //! where the reference changes rapidly, so Partials whose average
+  //! channel number lies very close to a channel boundary (half way
+  //! between two channel numbers) may occasionally be labeled
+  //! differently.
+  //!
+  //! \param begin is the beginning of the range of Partials to channelize
+  //! \param end is (one-past) the end of the range of Partials to channelize
+  //! \param numThreads is the number of threads to use, or 0 (the
+  //!        default) to use as many threads as the hardware supports.
+  void channelizeParallel(PartialList::iterator begin,
+                          PartialList::iterator end,
+                          unsigned int numThreads = 0) const;
+
   //! Function call operator: same as channelize().
 #if !defined(NO_TEMPLATE_MEMBERS)
   template <typename Iter>
@@ -263,6 +291,19 @@ public:
   //!         the reference envelope
   double referenceFrequencyAt(double time) const;
 
+  //! Compute the reference frequency at each of a sequence of times,
+  //! evaluating the reference envelope only once for the whole
+  //! sequence. Equivalent to calling referenceFrequencyAt for
+  //! each time, but much faster when the times are increasing.
+  //!
+  //! \param  times is an array of n times (in seconds) at which to
+  //!         evalute the reference envelope
+  //! \param  out is an array of (at least) n reference frequencies
+  //!         to fill
+  //! \param  n is the number of times
+  void referenceFrequencyAt(const double *times, double *out,
+                            std::size_t n) const;
+
   //  -- access/mutation --
 
   //! Return the exponent applied to amplitude before weighting
@@ -425,6 +466,10 @@ public:
                                 const Envelope &refChanFreq, int refChanLabel);
 #endif
 
+  //! The interval (in seconds) at which the reference Envelope is
+  //! sampled by channelizeParallel (1 ms).
+  static const double ReferenceSampleInterval;
+
   //! DEPRECATED
   //!
   //! Static member to compute the stretch factor for a sound having
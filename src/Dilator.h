@@ -33,10 +33,9 @@
  *
  */
 
-#if defined(NO_TEMPLATE_MEMBERS)
 #include "PartialList.h"
-#endif
 
+#include <cstddef>
 #include <vector>
 
 //	begin namespace
@@ -202,6 +201,35 @@ public:
   //! \return the dilated time corresponding to the initial time currentTime
   double warpTime(double currentTime) const;
 
+  //!	Compute the dilated time values corresponding to a sequence of
+  //!	initial times, storing them in out. The results are identical to
+  //!	those computed by warpTime(), but for runs of non-decreasing times
+  //!	(like the Breakpoint times in a Partial, or a time-sorted sequence
+  //!	of Markers) the time points are found by advancing a running index,
+  //!	rather than by searching for each time.
+  //!
+  //!	\param times is an array of n pre-dilated times.
+  //!	\param out is an array of (at least) n values to fill with the
+  //!	       dilated times, it may be the same array as times.
+  //!	\param n is the number of times.
+  void warpTimes(const double *times, double *out, std::size_t n) const;
+
+  //!	Non-uniformly expand and contract the parameter envelopes of the each
+  //!	Partial in the specified half-open range according to this Dilator's
+  //!	stored initial and target (desired) times, dividing the Partials
+  //!	among several threads. The results are identical to those of
+  //!	dilate().
+  //!
+  //!	\param dilate_begin is the beginning of a sequence of Partials to
+  //!	       dilate.
+  //!	\param dilate_end is (one-past) the end of a sequence of Partials
+  //!	       to dilate.
+  //!	\param numThreads is the number of threads to use, or 0 (the
+  //!	       default) to use as many threads as the hardware supports.
+  void dilateParallel(PartialList::iterator dilate_begin,
+                      PartialList::iterator dilate_end,
+                      unsigned int numThreads = 0) const;
+
   // -- static members --
 
   //!   Static member that constructs an instance and applies
@@ -238,6 +266,13 @@ public:
                             const double *tbegin);
 #endif
 
+  //	-- private helpers --
+private:
+  //	Return the dilated time value corresponding to the specified
+  //	initial time, given the index of the first initial time point
+  //	not earlier than currentTime.
+  double warpTimeAt(double currentTime, std::size_t idx) const;
+
 }; //	end of class Dilator
 
 // ---------------------------------------------------------------------------
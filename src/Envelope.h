@@ -33,6 +33,7 @@
  *
  */
 
+#include <cstddef>
 #include <memory> //	 for autoptr
 
 //	begin namespace
@@ -73,6 +74,18 @@ public:
   //!	Return the value of this Envelope at the specified time.
   virtual double valueAt(double x) const = 0;
 
+  //!	Evaluate this Envelope at each of a sequence of times, storing
+  //!	the values in out. The default implementation calls valueAt
+  //!	once per time; derived classes can do better, particularly
+  //!	when the times are non-decreasing, as they are when sampling
+  //!	an Envelope at the Breakpoint times of a Partial.
+  //!
+  //!	\param	times is an array of n times at which to evaluate the
+  //!			Envelope.
+  //!	\param	out is an array of (at least) n values to fill.
+  //!	\param	n is the number of times to evaluate.
+  virtual void valueAt(const double *times, double *out, std::size_t n) const;
+
 }; //	end of abstract class Envelope
 
 // ---------------------------------------------------------------------------
@@ -119,6 +132,14 @@ public:
     return m_offset + (m_scale * m_env->valueAt(x));
   }
 
+  //!	Evaluate this Envelope at each of a sequence of times.
+  virtual void valueAt(const double *times, double *out, std::size_t n) const {
+    m_env->valueAt(times, out, n);
+    for (std::size_t k = 0; k < n; ++k) {
+      out[k] = m_offset + (m_scale * out[k]);
+    }
+  }
+
   //  -- private member variables --
 
 private:
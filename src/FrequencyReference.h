@@ -123,6 +123,10 @@ public:
   //!	specified time.
   virtual double valueAt(double x) const;
 
+  //!	Evaluate this FrequencyReference at each of a sequence of times,
+  //!	storing the frequencies (in Hz) in out.
+  virtual void valueAt(const double *times, double *out, std::size_t n) const;
+
 }; // end of class FrequencyReference
 
 } // namespace Loris
@@ -46,6 +46,7 @@
 //  begin namespace
 namespace Loris {
 
+class AiffReader;
 class ReassignedSpectrum;
 
 // ---------------------------------------------------------------------------
@@ -421,6 +422,59 @@ public:
                       lowerFreqBound, upperFreqBound);
   }
 
+  //  -- estimation from AIFF samples files --
+
+  //  buildEnvelope
+  //
+  //! Construct a linear envelope from fundamental frequency
+  //! estimates taken at the specified interval in seconds
+  //! starting at tbeg (seconds) and ending before tend (seconds),
+  //! from the samples in an AIFF samples file. Only the samples
+  //! spanned by the analysis window at each estimate are read
+  //! from the file.
+  //!
+  //! \param  reader is an AiffReader for the samples file, the
+  //!         sample rate is the sample rate of the file
+  //! \param  tbeg is the beginning of the time interval (in seconds)
+  //! \param  tend is the end of the time interval (in seconds)
+  //! \param  interval is the time between breakpoints in the
+  //!         fundamental frequency envelope (in seconds)
+  //! \param  lowerFreqBound is the lower bound on the fundamental
+  //!         frequency estimate (in Hz)
+  //! \param  upperFreqBound is the lower bound on the fundamental
+  //!         frequency estimate (in Hz)
+  //! \param  confidenceThreshold is the minimum confidence level
+  //!         resuired for a fundamental frequency estimate to be
+  //!         added to the envelope
+  //! \return a LinearEnvelope composed of breakpoints corresponding to
+  //!         the fundamental frequency estimates having confidence
+  //!         level exceeding the specified confidence threshold
+  LinearEnvelope buildEnvelope(const AiffReader &reader, double tbeg,
+                               double tend, double interval,
+                               double lowerFreqBound, double upperFreqBound,
+                               double confidenceThreshold);
+
+  //  estimateAt
+  //
+  //! Return an estimate of the fundamental frequency computed
+  //! at the specified time from the samples in an AIFF samples
+  //! file. Only the samples spanned by the analysis window are
+  //! read from the file.
+  //!
+  //! \param  reader is an AiffReader for the samples file, the
+  //!         sample rate is the sample rate of the file
+  //! \param  time is the time in seconds at which to attempt to estimate
+  //!         the fundamental frequency
+  //! \param  lowerFreqBound is the lower bound on the fundamental
+  //!         frequency estimate (in Hz)
+  //! \param  upperFreqBound is the lower bound on the fundamental
+  //!         frequency estimate (in Hz)
+  //! \return the estimate of fundamental frequency in Hz and the
+  //!         confidence associated with that estimate (see
+  //!         F0Estimate.h)
+  value_type estimateAt(const AiffReader &reader, double time,
+                        double lowerFreqBound, double upperFreqBound);
+
   //  -- spectral analysis parameter access/mutation --
 
   //! Return the frequency-domain main lobe width (in Hz measured
@@ -474,6 +528,27 @@ private:
                            double sampleRate, std::vector<double> &frequencies,
                            std::vector<double> &amplitudes, double time);
 
+  //  collectFreqsAndAmps
+  //
+  //! Perform spectral analysis on the samples in an AIFF samples
+  //! file, reading only those spanned by an analysis window centered
+  //! at the specified time in seconds. Collect the frequencies and
+  //! amplitudes of the peaks and return them in the vectors provided.
+  void collectFreqsAndAmps(const AiffReader &reader,
+                           std::vector<double> &frequencies,
+                           std::vector<double> &amplitudes, double time);
+
+  //  collectPeakFreqsAndAmps
+  //
+  //! Perform spectral analysis on the samples on the range
+  //! [sampsBegin, sampsEnd), centered at winMiddle, and collect
+  //! the frequencies and amplitudes of the peaks.
+  void collectPeakFreqsAndAmps(const double *sampsBegin,
+                               const double *winMiddle,
+                               const double *sampsEnd, double sampleRate,
+                               std::vector<double> &frequencies,
+                               std::vector<double> &amplitudes);
+
   //  -- private member variables --
 
   std::unique_ptr<ReassignedSpectrum> m_spectrum;
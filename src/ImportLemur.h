@@ -36,11 +36,65 @@
 
 #include "LorisExceptions.h"
 #include "PartialList.h"
+#include <memory>
 #include <string>
 
 //	begin namespace
 namespace Loris {
 
+class MappedFile;
+class Partial;
+
+// ---------------------------------------------------------------------------
+//	class LemurReader
+//
+//	LemurReader reads the Partials stored in a Lemur 5 alpha file one
+//	at a time, so that a large file can be converted or processed
+//	without holding all of its Partials in memory. The file is mapped
+//	(see MappedFile.h), and the peaks in each track are decoded directly
+//	from the mapped bytes, so only the pages holding the track being
+//	read need be resident.
+//
+//	Clients should be prepared to catch ImportExceptions.
+//
+class LemurReader {
+  //	-- instance variables --
+  std::unique_ptr<MappedFile> mFile; //	the file contents
+  const unsigned char *mFirstTrack;  //	first byte of the first track
+  const unsigned char *mPos;         //	first byte of the next track
+  const unsigned char *mEnd;         //	one past the end of the file
+  unsigned long mNumTracks;          //	number of tracks in the file
+  unsigned long mTracksRead;         //	number of tracks read so far
+  double mBweCutoff;                 //	bandwidth cutoff frequency
+
+  //	-- public interface --
+public:
+  //	construction:
+  //	Open the file and read its headers, leaving the reader
+  //	positioned at the first track.
+  //	bweCutoff defaults to 1kHz, the default cutoff in Lemur.
+  explicit LemurReader(const std::string &fname, double bweCutoff = 1000);
+  ~LemurReader(void);
+
+  //	Read the next track into the specified Partial, replacing its
+  //	contents, and return true, or return false if there are no more
+  //	tracks. Tracks of zero duration are skipped.
+  bool next(Partial &p);
+
+  //	Return the reader to the first track.
+  void rewind(void);
+
+  //	Return the number of tracks in the file, including tracks
+  //	of zero duration, which are never read.
+  unsigned long numTracks(void) const { return mNumTracks; }
+
+  //	-- unimplemented --
+private:
+  LemurReader(const LemurReader &other);
+  LemurReader &operator=(const LemurReader &rhs);
+
+}; //	end of class LemurReader
+
 // ---------------------------------------------------------------------------
 //	class ImportLemur
 //
@@ -98,6 +98,19 @@ public:
   //!         LinearEnvelope.
   virtual double valueAt(double t) const;
 
+  //! Evaluate this LinearEnvelope at each of a sequence of times,
+  //! storing the linearly-interpolated values in out. Runs of
+  //! non-decreasing times are evaluated by advancing a single cursor
+  //! through the breakpoints, rather than searching for each time,
+  //! so sampling at the (sorted) Breakpoint times of a Partial costs
+  //! time linear in the number of breakpoints and times.
+  //!
+  //! \param  times is an array of n times at which to evaluate this
+  //!         LinearEnvelope.
+  //! \param  out is an array of (at least) n values to fill.
+  //! \param  n is the number of times to evaluate.
+  virtual void valueAt(const double *times, double *out, std::size_t n) const;
+
   //  -- envelope composition --
 
   //! Insert a breakpoint representing the specified (time, value)
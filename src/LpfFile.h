@@ -0,0 +1,384 @@
+#ifndef INCLUDE_LPFFILE_H
+#define INCLUDE_LPFFILE_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * LpfFile.h
+ *
+ * Definition of LpfFile class for Partial import and export in the
+ * native Loris Partial Format (LPF), and of LpfReader, for random
+ * access to the Partials in a memory-mapped LPF file.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#include "Marker.h"
+#include "Partial.h"
+#include "PartialList.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+//	begin namespace
+namespace Loris {
+
+class MappedFile;
+
+// ---------------------------------------------------------------------------
+//	class LpfFile
+//
+//!	Class LpfFile represents reassigned bandwidth-enhanced Partial
+//!	data in a Loris Partial Format (LPF) file. Construction of an LpfFile
+//!	from a filename automatically imports the Partial data.
+//!
+//!	LPF stores each Partial's Breakpoints as contiguous columns, so
+//!	that any Partial can be read without scanning the others, and an
+//!	index at the start of the file records the label, time span, and
+//!	location of every Partial. All values are little-endian. The file
+//!	consists of:
+//!
+//!	- a 32-byte header: the signature "LPF1", the format version (1),
+//!	  flags (bit 0 set if the parameter columns are 32-bit floats),
+//!	  the number of Partials, the number of Markers, four reserved
+//!	  bytes, and the 64-bit byte offset of the Markers.
+//!	- the index, 32 bytes per Partial: the 32-bit label, the 32-bit
+//!	  number of Breakpoints, the 64-bit float start and end times, and
+//!	  the 64-bit byte offset of the Partial's columns.
+//!	- the columns of each Partial: times (always 64-bit floats), then
+//!	  frequency, amplitude, bandwidth, and phase, padded to a multiple
+//!	  of 8 bytes.
+//!	- the Markers: for each, its 64-bit float time, the 32-bit length
+//!	  of its name, and the name, padded to a multiple of 8 bytes.
+//!
+//!	Partial data written as 64-bit floats are imported exactly. The
+//!	32-bit format halves the size of the parameter columns at the cost
+//!	of precision (times are still stored exactly).
+//
+class LpfFile {
+  //	-- public interface --
+public:
+  //	-- types --
+
+  //! The type of marker storage in an LpfFile.
+  typedef std::vector<Marker> markers_type;
+
+  //!	The type of the Partial storage in an LpfFile.
+  typedef PartialList partials_type;
+
+  //	-- construction --
+
+  //! Initialize an instance of LpfFile by importing Partial data from
+  //! the file having the specified filename or path.
+  //!
+  //! \throw FileIOException if the file cannot be read, or is not a
+  //!        valid LPF file.
+  explicit LpfFile(const std::string &filename);
+
+  //! Initialize an instance of LpfFile with copies of the Partials
+  //! on the specified half-open (STL-style) range.
+  //!
+  //! If compiled with NO_TEMPLATE_MEMBERS defined, this member accepts
+  //! only PartialList::const_iterator arguments.
+#if !defined(NO_TEMPLATE_MEMBERS)
+  template <typename Iter> LpfFile(Iter begin_partials, Iter end_partials);
+#else
+  LpfFile(PartialList::const_iterator begin_partials,
+          PartialList::const_iterator end_partials);
+#endif
+
+  //! Initialize an empty instance of LpfFile having no Partials.
+  LpfFile(void);
+
+  //	copy, assign, and delete are compiler-generated
+
+  //	-- access --
+
+  //! Return a reference to the Markers (see Marker.h)
+  //! for this LpfFile.
+  markers_type &markers(void);
+
+  //! Return a reference to the Markers (see Marker.h)
+  //! for this LpfFile.
+  const markers_type &markers(void) const;
+
+  //!	Return a reference to the bandwidth-enhanced
+  //! Partials represented by this LpfFile.
+  partials_type &partials(void);
+
+  //!	Return a reference to the bandwidth-enhanced
+  //! Partials represented by this LpfFile.
+  const partials_type &partials(void) const;
+
+  //	-- mutation --
+
+  //! Add a copy of the specified Partial to this LpfFile.
+  void addPartial(const Loris::Partial &p);
+
+  //! Add a copy of each Partial on the specified half-open (STL-style)
+  //! range to this LpfFile.
+  //!
+  //! If compiled with NO_TEMPLATE_MEMBERS defined, this member accepts
+  //! only PartialList::const_iterator arguments.
+#if !defined(NO_TEMPLATE_MEMBERS)
+  template <typename Iter>
+  void addPartials(Iter begin_partials, Iter end_partials);
+#else
+  void addPartials(PartialList::const_iterator begin_partials,
+                   PartialList::const_iterator end_partials);
+#endif
+
+  //	-- export --
+
+  //! Export the Partials and Markers represented by this LpfFile to
+  //! the file having the specified filename or path, storing all
+  //! values as 64-bit floats. Empty Partials are not exported.
+  //!
+  //! \throw FileIOException if the file cannot be written.
+  void write(const std::string &path) const;
+
+  //! Export the Partials and Markers represented by this LpfFile to
+  //! the file having the specified filename or path, storing the
+  //! frequency, amplitude, bandwidth, and phase columns as 32-bit
+  //! floats. Empty Partials are not exported.
+  //!
+  //! \throw FileIOException if the file cannot be written.
+  void writeFloat32(const std::string &path) const;
+
+private:
+  //	-- implementation --
+  void write(const std::string &path, bool float32) const;
+
+  partials_type partials_; //	Partials to store in LPF format
+  markers_type markers_;   // 	Markers
+
+}; //	end of class LpfFile
+
+// ---------------------------------------------------------------------------
+//	class LpfReader
+//
+//!	Class LpfReader provides read-only random access to the Partials
+//!	in a Loris Partial Format (LPF) file (see LpfFile). The file is
+//!	mapped into memory, and only the header, index, and markers are
+//!	decoded when the reader is constructed. Individual Partials can be
+//!	viewed in place, without copying their Breakpoints, or imported
+//!	selectively, by index, label, or time.
+//!
+//!	LpfReader cannot be copied. Several threads may read the same
+//!	LpfReader at once.
+//
+class LpfReader {
+  //	-- public interface --
+public:
+  //	-- types --
+
+  //! The type of marker storage in an LpfReader.
+  typedef LpfFile::markers_type markers_type;
+
+  //! The type of Partial indices in an LpfReader.
+  typedef std::vector<Partial>::size_type size_type;
+
+  //	-- class View --
+  //
+  //!	A View provides read-only access to the Breakpoints of one
+  //!	Partial, decoded on demand from the mapped file. A View is
+  //!	valid only as long as the LpfReader that created it.
+  class View {
+  public:
+    //! Return the label of the viewed Partial.
+    Partial::label_type label(void) const { return mLabel; }
+
+    //! Return the number of Breakpoints in the viewed Partial.
+    size_type numBreakpoints(void) const { return mCount; }
+
+    //! Return the time of the first Breakpoint in the viewed Partial.
+    double startTime(void) const { return mStartTime; }
+
+    //! Return the time of the last Breakpoint in the viewed Partial.
+    double endTime(void) const { return mEndTime; }
+
+    //! Return the time of the kth Breakpoint.
+    double time(size_type k) const;
+
+    //! Return the frequency of the kth Breakpoint.
+    double frequency(size_type k) const { return param(0, k); }
+
+    //! Return the amplitude of the kth Breakpoint.
+    double amplitude(size_type k) const { return param(1, k); }
+
+    //! Return the bandwidth of the kth Breakpoint.
+    double bandwidth(size_type k) const { return param(2, k); }
+
+    //! Return the phase of the kth Breakpoint.
+    double phase(size_type k) const { return param(3, k); }
+
+    //! Return a copy of the kth Breakpoint.
+    Breakpoint breakpoint(size_type k) const;
+
+    //! Return a copy of the viewed Partial.
+    Partial partial(void) const;
+
+    //! Return the interpolated parameters of the viewed Partial at the
+    //! specified time, exactly as Partial::parametersAt would for a
+    //! copy of the viewed Partial, but without copying it.
+    //!
+    //! \throw InvalidPartial if the viewed Partial has no Breakpoints.
+    Breakpoint parametersAt(
+        double time, double fadeTime = Partial::ShortestSafeFadeTime) const;
+
+    //! Return the interpolated parameters of the viewed Partial at the
+    //! specified time, using and updating pos as a hint for the
+    //! Breakpoint search, as Partial::parametersAt does with an iterator
+    //! hint. pos is the index of the first Breakpoint not earlier than
+    //! the last time evaluated; numBreakpoints() starts a new search.
+    //!
+    //! \throw InvalidPartial if the viewed Partial has no Breakpoints.
+    Breakpoint parametersAt(
+        double time, size_type &pos,
+        double fadeTime = Partial::ShortestSafeFadeTime) const;
+
+  private:
+    friend class LpfReader;
+
+    double param(int column, size_type k) const;
+    void fill(Partial &p) const;
+
+    const unsigned char *mColumns; // first byte of the times column
+    size_type mCount;
+    Partial::label_type mLabel;
+    double mStartTime, mEndTime;
+    bool mFloat32;
+  };
+
+  //	-- construction --
+
+  //! Initialize an instance of LpfReader for the LPF file having the
+  //! specified filename or path.
+  //!
+  //! \throw FileIOException if the file cannot be read, or is not a
+  //!        valid LPF file.
+  explicit LpfReader(const std::string &filename);
+
+  //! Destroy this LpfReader, unmapping the file.
+  ~LpfReader(void);
+
+  //	-- access --
+
+  //! Return the number of Partials in the file.
+  size_type numPartials(void) const { return mIndex.size(); }
+
+  //! Return true if the parameter columns in the file are 32-bit floats.
+  bool isFloat32(void) const { return mFloat32; }
+
+  //! Return a View of the Partial at the specified position in the file.
+  //!
+  //! \throw IndexOutOfBounds if there is no such Partial.
+  View view(size_type idx) const;
+
+  //! Return a copy of the Partial at the specified position in the file.
+  //!
+  //! \throw IndexOutOfBounds if there is no such Partial.
+  Partial partial(size_type idx) const;
+
+  //! Return the Markers stored in the file.
+  const markers_type &markers(void) const { return mMarkers; }
+
+  //	-- import --
+
+  //! Append copies of all the Partials in the file to the specified
+  //! PartialList.
+  void getPartials(PartialList &dst) const;
+
+  //! Append copies of the Partials in the file having the specified
+  //! label to the specified PartialList.
+  void getPartialsLabeled(Partial::label_type label, PartialList &dst) const;
+
+  //! Append copies of the Partials in the file that are active at any
+  //! time between tbeg and tend (inclusive) to the specified
+  //! PartialList. The Partials are not cropped. Only the index is
+  //! consulted to select the Partials.
+  void getPartialsInWindow(double tbeg, double tend, PartialList &dst) const;
+
+private:
+  //	-- implementation --
+  static void append(const View &v, PartialList &dst);
+
+  std::unique_ptr<MappedFile> mFile;
+  std::vector<View> mIndex;
+  markers_type mMarkers;
+  bool mFloat32;
+
+  //	not implemented
+  LpfReader(const LpfReader &);
+  LpfReader &operator=(const LpfReader &);
+
+}; //	end of class LpfReader
+
+// -- template members --
+
+// ---------------------------------------------------------------------------
+//	constructor from Partial range
+// ---------------------------------------------------------------------------
+//	Initialize an instance of LpfFile with copies of the Partials
+//	on the specified half-open (STL-style) range.
+//
+//	If compiled with NO_TEMPLATE_MEMBERS defined, this member accepts
+//	only PartialList::const_iterator arguments.
+//
+#if !defined(NO_TEMPLATE_MEMBERS)
+template <typename Iter>
+LpfFile::LpfFile(Iter begin_partials, Iter end_partials)
+#else
+inline LpfFile::LpfFile(PartialList::const_iterator begin_partials,
+                        PartialList::const_iterator end_partials)
+#endif
+{
+  addPartials(begin_partials, end_partials);
+}
+
+// ---------------------------------------------------------------------------
+//	addPartials
+// ---------------------------------------------------------------------------
+//	Add a copy of each Partial on the specified half-open (STL-style)
+//	range to this LpfFile.
+//
+//	If compiled with NO_TEMPLATE_MEMBERS defined, this member accepts
+//	only PartialList::const_iterator arguments.
+//
+#if !defined(NO_TEMPLATE_MEMBERS)
+template <typename Iter>
+void LpfFile::addPartials(Iter begin_partials, Iter end_partials)
+#else
+inline void LpfFile::addPartials(PartialList::const_iterator begin_partials,
+                                 PartialList::const_iterator end_partials)
+#endif
+{
+  partials_.insert(partials_.end(), begin_partials, end_partials);
+}
+
+} // namespace Loris
+
+#endif /* ndef INCLUDE_LPFFILE_H */
@@ -0,0 +1,95 @@
+#ifndef INCLUDE_MAPPEDFILE_H
+#define INCLUDE_MAPPEDFILE_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * MappedFile.h
+ *
+ * Definition of class MappedFile, read-only access to the contents of
+ * a file mapped into memory. Used internally by the Loris file import
+ * classes, so that large files can be decoded in place, without
+ * copying them through stdio buffers.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+//	begin namespace
+namespace Loris {
+
+// ---------------------------------------------------------------------------
+//	class MappedFile
+//
+//	MappedFile provides read-only access to the entire contents of a
+//	file. Where memory mapping is supported (POSIX systems) the file is
+//	mapped, and pages are read from the file on demand, otherwise the
+//	contents of the file are read into memory when the MappedFile is
+//	constructed. Either way, the contents are available until the
+//	MappedFile is destroyed.
+//
+//	MappedFile cannot be copied, but several threads may read the same
+//	MappedFile at once.
+//
+class MappedFile {
+  //	-- instance variables --
+
+  const unsigned char *mData; //	the file contents
+  std::size_t mSize;          //	the number of bytes in the file
+  bool mIsMapped;             //	true if mData refers to mapped memory
+  std::vector<unsigned char> mBuffer; //	file contents, if not mapped
+
+  //	-- public interface --
+public:
+  //	-- construction --
+
+  //	Map (or read) the file at the specified path. Throw a
+  //	FileIOException if the file cannot be opened or read.
+  explicit MappedFile(const std::string &path);
+
+  //	Unmap (or release) the contents of the file.
+  ~MappedFile(void);
+
+  //	-- access --
+
+  //	Return a pointer to the first byte of the file contents,
+  //	or 0 if the file is empty.
+  const unsigned char *data(void) const { return mData; }
+
+  //	Return the number of bytes in the file.
+  std::size_t size(void) const { return mSize; }
+
+  //	-- unimplemented --
+private:
+  MappedFile(const MappedFile &);
+  MappedFile &operator=(const MappedFile &);
+
+}; //	end of class MappedFile
+
+} // namespace Loris
+
+#endif /* ndef INCLUDE_MAPPEDFILE_H */
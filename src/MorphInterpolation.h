@@ -0,0 +1,180 @@
+#ifndef INCLUDE_MORPHINTERPOLATION_H
+#define INCLUDE_MORPHINTERPOLATION_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * MorphInterpolation.h
+ *
+ * Interpolation of Breakpoint parameters for morphing, shared by
+ * Morpher and RealtimeMorpher. Used internally.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#include "Breakpoint.h"
+#include "Morpher.h"
+
+#include <algorithm>
+#include <cmath>
+
+//	begin namespace
+namespace Loris {
+
+// ---------------------------------------------------------------------------
+//	morphLog
+// ---------------------------------------------------------------------------
+//	Log-domain interpolation
+//	(originally was for amplitude only).
+//
+//	alpha == 0 returns x, alpha == 1 returns y
+//
+//	It is essential to add in a small offset, so that
+//	occasional zero amplitudes do not introduce artifacts
+//	(if amp is zero, then even if alpha is very small
+//	the effect is to multiply by zero, because 0^x = 0,
+//	or note that log(0) is -infinity).
+//
+//	This shaping parameter affects the shape of the morph
+//	curve only when it is of the same order of magnitude as
+//	one of the sources (x or y) and the other is much larger.
+//
+//	When shape is very small, the curve representing the
+//	morphed amplitude is very steep, such that there is a
+//	huge difference between zero amplitude and very small
+//	amplitude, and this causes audible artifacts. So instead
+//	use a larger value that shapes the curve more nicely.
+//	Just have to subtract this value from the morphed
+//	amplitude to avoid raising the noise floor a whole lot.
+//
+inline double morphLog(double x, double y, double alpha, double shape) {
+  const double s = x + shape;
+  const double t = y + shape;
+  return (s * std::pow(t / s, alpha)) - shape;
+}
+
+// ---------------------------------------------------------------------------
+//	morphLinear
+// ---------------------------------------------------------------------------
+//	Linear interpolation, alpha == 0 returns x, alpha == 1 returns y.
+//
+inline double morphLinear(double x, double y, double alpha) {
+  return (x * (1 - alpha)) + (y * alpha);
+}
+
+// ---------------------------------------------------------------------------
+//	morphAmplitude
+// ---------------------------------------------------------------------------
+//	Interpolate amplitudes (or bandwidths), in the log domain if
+//	doLog is true, using the specified shaping parameter. The result
+//	is never negative.
+//
+inline double morphAmplitude(double srcAmp, double tgtAmp, double alpha,
+                             bool doLog, double shape) {
+  double morphedAmp = 0;
+
+  if (doLog) {
+    //  if both are small, just return 0
+    //  HEY, is this really what we want?
+    static const double Epsilon = 1E-12;
+    if ((srcAmp > Epsilon) || (tgtAmp > Epsilon)) {
+      morphedAmp = morphLog(srcAmp, tgtAmp, alpha, shape);
+    }
+  } else {
+    morphedAmp = morphLinear(srcAmp, tgtAmp, alpha);
+  }
+
+  //  Partial amplitudes should never be negative
+  return std::max(0.0, morphedAmp);
+}
+
+// ---------------------------------------------------------------------------
+//	morphFrequency
+// ---------------------------------------------------------------------------
+//	Interpolate frequencies, in the log domain if doLog is true.
+//
+inline double morphFrequency(double srcFreq, double tgtFreq, double alpha,
+                             bool doLog) {
+  if (doLog) {
+    //  guard against the extremely unlikely possibility that
+    //  one of the frequencies is zero
+    const double shape =
+        (0 == srcFreq || 0 == tgtFreq) ? Morpher::DefaultAmpShape : 0.;
+    return morphLog(srcFreq, tgtFreq, alpha, shape);
+  }
+  return morphLinear(srcFreq, tgtFreq, alpha);
+}
+
+// ---------------------------------------------------------------------------
+//	morphPhase
+// ---------------------------------------------------------------------------
+//	Interpolate raw absolute phase values. If the interpolated
+//	phase matters at all (near the morphing function boudaries 0
+//	and 1) then that will give a good target phase value, and the
+//	frequency will be adjusted to match the phase. Otherwise,
+//	the phase will just be recomputed to match the interpolated
+//	frequency.
+//
+inline double morphPhase(double srcphase, double tgtphase, double alpha) {
+  const double Pi = 3.14159265358979324;
+
+  //  wrap the phases so that they are as similar as possible,
+  //  so that phase interpolation is shift-invariant.
+  while ((srcphase - tgtphase) > Pi) {
+    srcphase -= 2 * Pi;
+  }
+  while ((tgtphase - srcphase) > Pi) {
+    srcphase += 2 * Pi;
+  }
+
+  return std::fmod(morphLinear(srcphase, tgtphase, alpha), 2 * Pi);
+}
+
+// ---------------------------------------------------------------------------
+//	morphParameters
+// ---------------------------------------------------------------------------
+//	Interpolate all the parameters of two Breakpoints, using the
+//	specified frequency (also used for phase), amplitude, and bandwidth
+//	weights. Amplitude and bandwidth are interpolated in the log domain
+//	if logAmp is true, using the specified shaping parameter, and
+//	frequency is interpolated in the log domain if logFreq is true.
+//
+inline Breakpoint morphParameters(const Breakpoint &srcBkpt,
+                                  const Breakpoint &tgtBkpt, double fweight,
+                                  double aweight, double bweight, bool logAmp,
+                                  double shape, bool logFreq) {
+  Breakpoint morphed;
+  morphed.setFrequency(morphFrequency(srcBkpt.frequency(), tgtBkpt.frequency(),
+                                      fweight, logFreq));
+  morphed.setAmplitude(morphAmplitude(srcBkpt.amplitude(), tgtBkpt.amplitude(),
+                                      aweight, logAmp, shape));
+  morphed.setBandwidth(morphAmplitude(srcBkpt.bandwidth(), tgtBkpt.bandwidth(),
+                                      bweight, logAmp, shape));
+  morphed.setPhase(morphPhase(srcBkpt.phase(), tgtBkpt.phase(), fweight));
+  return morphed;
+}
+
+} // namespace Loris
+
+#endif /* ndef INCLUDE_MORPHINTERPOLATION_H */
@@ -538,11 +538,18 @@ private:
   //!         value of 1, evaluated at the specified time.
   //! \param  time is the time corresponding to srcBkpt (used
   //!         to evaluate the morphing functions and tgtPartial).
+  //! \param  fweight is the value of the frequency morphing function
+  //!         at the specified time.
+  //! \param  aweight is the value of the amplitude morphing function
+  //!         at the specified time.
+  //! \param  bweight is the value of the bandwidth morphing function
+  //!         at the specified time.
   //! \param  newp is the morphed Partial under construction, the morphed
   //!         Breakpoint is added to this Partial.
   //
   void appendMorphedSrc(Breakpoint srcBkpt, const Partial &tgtPartial,
-                        double time, Partial &newp);
+                        double time, double fweight, double aweight,
+                        double bweight, Partial &newp);
 
   //! Compute morphed parameter values at the specified time, using
   //! the target Breakpoint (assumed to correspond exactly to the
@@ -559,11 +566,18 @@ private:
   //!         value of 0, evaluated at the specified time.
   //! \param  time is the time corresponding to srcBkpt (used
   //!         to evaluate the morphing functions and srcPartial).
+  //! \param  fweight is the value of the frequency morphing function
+  //!         at the specified time.
+  //! \param  aweight is the value of the amplitude morphing function
+  //!         at the specified time.
+  //! \param  bweight is the value of the bandwidth morphing function
+  //!         at the specified time.
   //! \param  newp is the morphed Partial under construction, the morphed
   //!         Breakpoint is added to this Partial.
   //
   void appendMorphedTgt(Breakpoint tgtBkpt, const Partial &srcPartial,
-                        double time, Partial &newp);
+                        double time, double fweight, double aweight,
+                        double bweight, Partial &newp);
 
   //!	Parameterinterpolation helpers.
   Breakpoint interpolateParameters(const Breakpoint &srcBkpt,
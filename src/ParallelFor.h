@@ -0,0 +1,162 @@
+#ifndef INCLUDE_PARALLELFOR_H
+#define INCLUDE_PARALLELFOR_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * ParallelFor.h
+ *
+ * Helpers for splitting work on a collection of Partials (or anything
+ * else that can be indexed) across several threads. Used internally
+ * by the parallel modes of some of the Loris algorithms.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+//	begin namespace
+namespace Loris {
+
+// ---------------------------------------------------------------------------
+//	threadCount
+// ---------------------------------------------------------------------------
+//	Return the number of threads to use for a job having numItems
+//	independent items, when the client has requested numThreads
+//	threads. A request for zero threads means "as many as the
+//	hardware supports". Never more threads than items, never fewer
+//	than one.
+//
+inline unsigned int threadCount(unsigned int numThreads,
+                                std::size_t numItems) {
+  if (0 == numThreads) {
+    numThreads = std::thread::hardware_concurrency();
+  }
+  if (numThreads > numItems) {
+    numThreads = static_cast<unsigned int>(numItems);
+  }
+  return (0 < numThreads) ? numThreads : 1;
+}
+
+// ---------------------------------------------------------------------------
+//	partitionByWeight
+// ---------------------------------------------------------------------------
+//	Partition the range of indices [0, weights.size()) into at most
+//	numParts contiguous subranges having approximately equal total
+//	weight (for example, the number of Breakpoints in a sequence of
+//	Partials). Return the boundaries of the subranges, the first is
+//	always 0 and the last is always weights.size().
+//
+inline std::vector<std::size_t>
+partitionByWeight(const std::vector<std::size_t> &weights,
+                  unsigned int numParts) {
+  std::size_t total = 0;
+  for (std::size_t k = 0; k < weights.size(); ++k) {
+    total += weights[k];
+  }
+
+  std::vector<std::size_t> bounds(1, 0);
+  std::size_t sum = 0;
+  for (std::size_t k = 0; k < weights.size(); ++k) {
+    sum += weights[k];
+
+    //	close the current part once it has its
+    //	share of the total weight:
+    const std::size_t part = bounds.size();
+    if (part < numParts && sum * numParts >= total * part) {
+      bounds.push_back(k + 1);
+    }
+  }
+  if (bounds.back() != weights.size()) {
+    bounds.push_back(weights.size());
+  }
+  return bounds;
+}
+
+// ---------------------------------------------------------------------------
+//	parallelFor
+// ---------------------------------------------------------------------------
+//	Invoke func( begin, end ) for each pair of consecutive boundaries in
+//	bounds (as computed by partitionByWeight), each on its own thread. The
+//	calling thread processes the last subrange itself, and waits for the
+//	others to finish. If any invocation of func throws an exception, the
+//	first one caught is rethrown in the calling thread after all threads
+//	have finished.
+//
+//	If a thread cannot be started (the system is out of threads or
+//	memory), no more are started, and the calling thread processes the
+//	subranges that have no thread, so the threads already started are
+//	always joined.
+//
+template <typename Func>
+void parallelFor(const std::vector<std::size_t> &bounds, Func func) {
+  if (bounds.size() < 2) {
+    return;
+  }
+
+  const std::size_t nparts = bounds.size() - 1;
+  std::vector<std::exception_ptr> errors(nparts);
+  std::vector<std::thread> workers;
+  workers.reserve(nparts - 1);
+
+  auto run = [&func, &bounds, &errors](std::size_t k) {
+    try {
+      func(bounds[k], bounds[k + 1]);
+    } catch (...) {
+      errors[k] = std::current_exception();
+    }
+  };
+
+  //	workers has room for every thread, so push_back
+  //	cannot throw once a thread has been started:
+  std::size_t started = 0;
+  try {
+    for (; started + 1 < nparts; ++started) {
+      workers.push_back(std::thread([&run, started]() { run(started); }));
+    }
+  } catch (...) {
+    //	process the rest in this thread
+  }
+
+  for (std::size_t k = started; k < nparts; ++k) {
+    run(k);
+  }
+
+  for (std::size_t k = 0; k < workers.size(); ++k) {
+    workers[k].join();
+  }
+
+  for (std::size_t k = 0; k < nparts; ++k) {
+    if (errors[k]) {
+      std::rethrow_exception(errors[k]);
+    }
+  }
+}
+
+} // namespace Loris
+
+#endif /* ndef INCLUDE_PARALLELFOR_H */
@@ -332,6 +332,16 @@ public:
   //!			pair nearest (in time) to the specified time.
   const_iterator findNearest(double time) const;
 
+  //!	Replace the times of the Breakpoints in this Partial, in order,
+  //!	by the specified times, without copying any Breakpoints. The
+  //!	result is the same as that of inserting the Breakpoints, in
+  //!	order, at the new times in an empty Partial, so Breakpoints
+  //!	closer together than 1ns are merged as by insert.
+  //!
+  //!	\param	times is an array of numBreakpoints() new times, in
+  //!			the order of the Breakpoints.
+  void retime(const double *times);
+
   //!	Set the label for this Partial to the specified 32-bit value.
   void setLabel(label_type l);
 
@@ -431,6 +441,28 @@ public:
   Breakpoint parametersAt(double time,
                           double fadeTime = ShortestSafeFadeTime) const;
 
+  //!	Return the interpolated parameters of this Partial at
+  //!	the specified time, exactly as parametersAt( time, fadeTime ),
+  //!	using and updating pos as a hint for the Breakpoint envelope
+  //!	search. When a sequence of non-decreasing times is evaluated
+  //!	using the same hint, the search advances linearly from the
+  //!	previous position, instead of starting over each time. The
+  //!	search starts over if the hint is past the specified time.
+  //!
+  //!	\param	time is the time in seconds at which to evaluate the
+  //!			Partial.
+  //!	\param	pos is a position in this Partial (possibly end()), it
+  //!			is updated when the envelope is searched.
+  //!	\param	fadeTime is the duration in seconds over which Partial
+  //!			amplitudes fade at the ends. The default value is
+  //!			ShortestSafeFadeTime, 1 ns.
+  //!	\return	A Breakpoint describing the parameters of this Partial
+  //!			at the specified time.
+  //! \pre	The Partial must have at least one Breakpoint.
+  //!	\throw	InvalidPartial if the Partial has no Breakpoints.
+  Breakpoint parametersAt(double time, const_iterator &pos,
+                          double fadeTime = ShortestSafeFadeTime) const;
+
   //	-- implementation --
 private:
   label_type _label;
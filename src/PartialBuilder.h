@@ -46,7 +46,9 @@
 #include "PartialPtrs.h"
 #include "SpectralPeaks.h"
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 //	begin namespace
 namespace Loris {
@@ -101,12 +103,19 @@ public:
 private:
   // --- auxiliary member functions ---
 
-  double warped_freq_distance(const Partial &partial, const SpectralPeak &pk);
+  //  Matching uses warped frequencies, the frequencies of the peaks
+  //  and of the ends of the eligible Partials normalized by the value
+  //  of the warping envelope. These are computed in batches for each
+  //  frame, and stored by peak and eligible Partial position.
+  void compute_warped_freqs(const Peaks &peaks);
 
-  bool better_match(const Partial &part, const SpectralPeak &pk1,
-                    const SpectralPeak &pk2);
-  bool better_match(const Partial &part1, const Partial &part2,
-                    const SpectralPeak &pk);
+  double warped_freq_distance(std::size_t partialIdx,
+                              std::size_t peakIdx) const;
+
+  bool better_peak_match(std::size_t partIdx, std::size_t pkIdx1,
+                         std::size_t pkIdx2) const;
+  bool better_partial_match(std::size_t partIdx1, std::size_t partIdx2,
+                            std::size_t pkIdx) const;
 
   // --- collected partials ---
 
@@ -117,6 +126,11 @@ private:
   PartialPtrs mEligiblePartials;
   PartialPtrs mNewlyEligible; // 	keep track of eligible partials here
 
+  std::vector<double> mWarpedPeakFreqs;     //  by position in Peaks
+  std::vector<double> mWarpedEligibleFreqs; //  by position in mEligiblePartials
+  std::vector<double> mWarpTimes;           //  scratch space
+  std::vector<double> mWarpValues;          //  scratch space
+
   // --- parameters ---
 
   std::unique_ptr<Envelope> mFreqWarping; //	reference envelope
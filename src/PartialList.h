@@ -41,6 +41,8 @@
 
 #include <functional>
 #include <list>
+#include <map>
+#include <mutex>
 
 //	begin namespace
 namespace Loris {
@@ -71,6 +73,23 @@ clone<std::list<Partial>>(const std::list<Partial> *tp) {
 //!
 //!	The associated bidirectional iterators are also defined as
 //!	PartialListIterator and PartialListConstIterator.
+//!
+//! A PartialList can optionally maintain an index of its Partials
+//! by label (see indexLabels()), so that the label operations
+//! (countLabeled, findLabeled, copyLabeled, extractLabeled, and
+//! removeLabeled) take time proportional to the number of Partials
+//! having the label, rather than to the size of the List. The index
+//! is updated by the members that add, remove, or move Partials (sort
+//! marks it as stale), and by setLabel( pos, label ). The List cannot
+//! detect changes to labels made directly through its iterators (for
+//! example, by Channelizer or Distiller), so after relabeling Partials
+//! that way, clients must call labelsChanged() to mark the index as
+//! stale. A stale index is rebuilt (in time proportional to the size
+//! of the List) by the next label operation.
+//!
+//! The const label operations may rebuild a stale index, but they do
+//! so under a lock, so like the other const members, they may be called
+//! by several threads at once.
 //
 class PartialList {
 
@@ -86,6 +105,26 @@ private:
   //! underlying container of Partials.
   list_ptr_type mList;
 
+  //! Type of the (optional) index of Partials by label. Partials
+  //! having the same label are stored in the same order as in the List.
+  typedef std::multimap<Partial::label_type,
+                        list_of_Partials_type::const_iterator>
+      label_index_type;
+
+  //! The index of Partials by label, if enabled and current.
+  mutable label_index_type mLabelIndex;
+
+  //! The container indexed by mLabelIndex, or 0 if the index is stale.
+  //! Copy-on-write may replace the container, so the index is current
+  //! only if this is the container that mList refers to.
+  mutable const list_of_Partials_type *mIndexedList;
+
+  //! Serializes rebuilding of the index by const label operations.
+  mutable std::mutex mLabelIndexMutex;
+
+  //! True if the label index is enabled.
+  bool mIndexLabels;
+
 public:
   //  --- types ---
 
@@ -117,7 +156,8 @@ public:
   PartialList(iterator b, iterator e)
       :
 #endif
-        mList(new list_of_Partials_type(b, e)) {
+        mList(new list_of_Partials_type(b, e)), mIndexedList(0),
+        mIndexLabels(false) {
   }
 
   //! Construct a PartialList that is a copy of another.
@@ -152,6 +192,62 @@ public:
   //! [b,e) must describe a valid range of Partials in this List
   PartialList extract(iterator b, iterator e);
 
+  //  --- label operations ---
+
+  //! Enable or disable the index of Partials by label. When enabled,
+  //! the index is built by the first label operation that needs it.
+  //!
+  //! \param  enable is true to enable the index (the default) and false
+  //!         to disable (and discard) it.
+  void indexLabels(bool enable = true);
+
+  //! Return true if the index of Partials by label is enabled, and
+  //! false otherwise.
+  bool hasLabelIndex(void) const { return mIndexLabels; }
+
+  //! Return the number of Partials in this List having the specified label.
+  //!
+  //! \param  label is the label of interest
+  size_type countLabeled(Partial::label_type label) const;
+
+  //! Return a position of the first Partial in this List having the
+  //! specified label, or end() if there is no such Partial.
+  //!
+  //! \param  label is the label of interest
+  const_iterator findLabeled(Partial::label_type label) const;
+
+  //! Append copies of the Partials in this List having the specified
+  //! label to another List, in the same order. This List is unmodified.
+  //!
+  //! \param  label is the label of interest
+  //! \param  dst is the List to which copies of the Partials are appended
+  void copyLabeled(Partial::label_type label, PartialList &dst) const;
+
+  //! Remove the Partials having the specified label from this List and
+  //! return a new List containing those Partials, in the same order.
+  //!
+  //! \param  label is the label of interest
+  //! \return a new PartialList containing the Partials having the label
+  PartialList extractLabeled(Partial::label_type label);
+
+  //! Remove (and destroy) all the Partials in this List having the
+  //! specified label.
+  //!
+  //! \param  label is the label of interest
+  void removeLabeled(Partial::label_type label);
+
+  //! Set the label of the Partial at the specified position in this
+  //! List, keeping the label index (if any) current.
+  //!
+  //! \param  pos is the position of a Partial in this List
+  //! \param  label is the new label for that Partial
+  void setLabel(iterator pos, Partial::label_type label);
+
+  //! Mark the label index (if any) as stale, so that it is rebuilt by
+  //! the next label operation. Call this after changing the labels of
+  //! Partials in this List other than by setLabel( pos, label ).
+  void labelsChanged(void) { invalidateLabelIndex(); }
+
   //  --- std::list interface ---
 
   //  PartialList implements many members of the std::list interface
@@ -182,37 +278,42 @@ public:
   const Partial &back(void) const { return mList->back(); }
 
   //! Same as the corresponding member of std::list.
-  void push_back(const Partial &val) { mList->push_back(val); }
+  void push_back(const Partial &val);
   //! Same as the corresponding member of std::list.
-  void push_front(const Partial &val) { mList->push_front(val); }
+  void push_front(const Partial &val);
 
   //! Same as the corresponding member of std::list.
-  iterator insert(iterator where, const Partial &val) {
-    return mList->insert(where, val);
-  }
+  iterator insert(iterator where, const Partial &val);
 
   //! Same as the corresponding member of std::list.
 #if !defined(NO_TEMPLATE_MEMBERS)
   template <class InIt> void insert(iterator where, InIt first, InIt last) {
-    mList->insert(where, first, last);
+    list_of_Partials_type &l = *mList;
+    const bool wasCurrent = labelIndexIsCurrent();
+    iterator inserted = l.insert(where, first, last);
+    indexInserted(wasCurrent, inserted, where);
   }
 #else
   void insert(iterator where, const_iterator first, const_iterator last) {
-    mList->insert(where, first, last);
+    list_of_Partials_type &l = *mList;
+    const bool wasCurrent = labelIndexIsCurrent();
+    iterator inserted = l.insert(where, first, last);
+    indexInserted(wasCurrent, inserted, where);
   }
 
   void insert(iterator where, iterator first, iterator last) {
-    mList->insert(where, first, last);
+    list_of_Partials_type &l = *mList;
+    const bool wasCurrent = labelIndexIsCurrent();
+    iterator inserted = l.insert(where, first, last);
+    indexInserted(wasCurrent, inserted, where);
   }
 #endif
 
   //! Same as the corresponding member of std::list.
-  iterator erase(iterator where) { return mList->erase(where); }
+  iterator erase(iterator where);
 
   //! Same as the corresponding member of std::list.
-  iterator erase(iterator first, iterator last) {
-    return mList->erase(first, last);
-  }
+  iterator erase(iterator first, iterator last);
 
   //! Same as the corresponding member of std::list.
   void clear(void) {
@@ -222,6 +323,7 @@ public:
     //   trigger a copy immediately before erasing all of the
     //   Partials.
     mList = list_ptr_type(new list_of_Partials_type);
+    resetLabelIndex();
   }
 
   //  query
@@ -236,9 +338,15 @@ public:
 
   //! Same as the corresponding member of std::list.
 #if !defined(NO_TEMPLATE_MEMBERS)
-  template <class Comparitor> void sort(Comparitor c) { mList->sort(c); }
+  template <class Comparitor> void sort(Comparitor c) {
+    invalidateLabelIndex();
+    mList->sort(c);
+  }
 #else
-  void sort(bool (*c)(const Partial &, const Partial &)) { mList->sort(c); }
+  void sort(bool (*c)(const Partial &, const Partial &)) {
+    invalidateLabelIndex();
+    mList->sort(c);
+  }
 #endif
 
   //  splicing
@@ -252,14 +360,12 @@ public:
   //! \param  other is the List of Partials to absorb into this List
   //!
   //! \post   other is an empty List, its former contents have been transfered
-  //!         to this List
+  //!         to this List (splicing a List into itself does nothing)
   //! \pre    pos is a valid position in this List
   //!
   //! \sa std::list::splice
   //
-  void splice(iterator pos, PartialList &other) {
-    mList->splice(pos, *other.mList);
-  }
+  void splice(iterator pos, PartialList &other);
 
   //! Same as the corresponding member of std::list.
   //! Transfer the Partials from one List to this List, same as
@@ -278,9 +384,7 @@ public:
   //!
   //! \sa std::list::splice
   //
-  void splice(iterator pos, PartialList &other, iterator first) {
-    mList->splice(pos, *other.mList, first);
-  }
+  void splice(iterator pos, PartialList &other, iterator first);
 
   //! Same as the corresponding member of std::list.
   //! Transfer the Partials from one List to this List, same as
@@ -300,10 +404,51 @@ public:
   //!
   //! \sa std::list::splice
   //
-  void splice(iterator pos, PartialList &other, iterator first, iterator last) {
-    mList->splice(pos, *other.mList, first, last);
+  void splice(iterator pos, PartialList &other, iterator first,
+              iterator last);
+
+  //! Transfer all the Partials from another List to the end of this List.
+  //!
+  //! \param  other is the List of Partials to absorb into this List
+  //!
+  //! \post   other is an empty List, its former contents have been transfered
+  //!         to the end of this List (splicing a List into itself does
+  //!         nothing)
+  //
+  void splice(PartialList &other);
+
+private:
+  //  --- label index helpers ---
+
+  //  Return the underlying container, without triggering a copy.
+  const list_of_Partials_type &constList(void) const { return *mList; }
+
+  //  Return true if the label index is enabled and current. Members
+  //  that modify the List must check this after getting non-const
+  //  access to the container, which may replace it.
+  bool labelIndexIsCurrent(void) const {
+    return mIndexLabels && mIndexedList == &constList();
   }
 
+  //  Mark the label index stale; it will be rebuilt when next needed.
+  void invalidateLabelIndex(void) { mIndexedList = 0; }
+
+  //  Make the label index current for an empty container.
+  void resetLabelIndex(void);
+
+  //  Return the label index, rebuilding it if it is stale.
+  const label_index_type &labelIndex(void) const;
+
+  //  Add the Partial at pos, or the Partials in [first,last), to
+  //  the current label index, or mark the index stale if it was
+  //  not current (wasCurrent) before they were added.
+  void indexInsert(const_iterator pos);
+  void indexInserted(bool wasCurrent, const_iterator first,
+                     const_iterator last);
+
+  //  Remove the Partial at pos from the current label index.
+  void indexErase(const_iterator pos);
+
 }; //   end of class PartialList
 
 // --- typedefs for iterators ---
@@ -0,0 +1,159 @@
+#ifndef INCLUDE_REALTIMEMORPHER_H
+#define INCLUDE_REALTIMEMORPHER_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * RealtimeMorpher.h
+ *
+ * Definition of class RealtimeMorpher.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+#include "Breakpoint.h"
+#include "Partial.h"
+
+#include <cstddef>
+#include <vector>
+
+//  begin namespace
+namespace Loris {
+
+// ---------------------------------------------------------------------------
+//  class RealtimeMorpher
+//
+//! Class RealtimeMorpher morphs sampled Partial parameter envelopes,
+//! one block at a time, for real-time synthesis. Where Morpher builds
+//! morphed Partials from whole source and target Partials, a
+//! RealtimeMorpher is given, for each block, a Breakpoint for each
+//! source and target Partial (their parameters at the current time)
+//! and the current values of the frequency, amplitude, and bandwidth
+//! morphing functions, and computes a morphed Breakpoint for each
+//! morphed Partial.
+//!
+//! The correspondence between source and target Partials is computed
+//! once, from their labels, when the RealtimeMorpher is constructed.
+//! Source and target Partials having the same non-zero label are
+//! morphed; labeled Partials having no counterpart, and all unlabeled
+//! Partials, are faded in or out. Morphing a block allocates no memory
+//! and evaluates no Envelopes, so it is safe to call from a real-time
+//! audio thread.
+//!
+//! The morphed parameters are the same as those computed by
+//! Morpher::morphBreakpoints, Morpher::fadeSrcBreakpoint, and
+//! Morpher::fadeTgtBreakpoint with the same settings.
+//
+class RealtimeMorpher {
+  //  -- public interface --
+public:
+  //  -- types --
+
+  //! The type of the indices of source, target, and morphed Partials.
+  typedef std::size_t size_type;
+
+  //  -- construction --
+
+  //! Construct a new RealtimeMorpher for source and target Partials
+  //! having the specified labels (the label of the ith source Partial
+  //! is srcLabels[i]). The morphed Partials are ordered first by
+  //! label, for the labeled Partials, followed by the unlabeled
+  //! source Partials, and then the unlabeled target Partials, each
+  //! in their original order. If several Partials in the source (or
+  //! the target) have the same non-zero label, only the last is
+  //! morphed.
+  //!
+  //! Logarithmic amplitude morphing, linear frequency morphing, and
+  //! the amplitude shape are initialized to the Morpher defaults.
+  //!
+  //! \param  srcLabels are the labels of the source Partials.
+  //! \param  tgtLabels are the labels of the target Partials.
+  RealtimeMorpher(const std::vector<Partial::label_type> &srcLabels,
+                  const std::vector<Partial::label_type> &tgtLabels);
+
+  //  compiler-generated copy, assignment, and destruction are OK.
+
+  //  -- morphing --
+
+  //! Compute a morphed Breakpoint for each morphed Partial.
+  //!
+  //! \param  src is an array holding a Breakpoint for each source
+  //!         Partial (the number of source labels).
+  //! \param  tgt is an array holding a Breakpoint for each target
+  //!         Partial (the number of target labels).
+  //! \param  fweight is the value of the frequency morphing function,
+  //!         0 for the source and 1 for the target.
+  //! \param  aweight is the value of the amplitude morphing function.
+  //! \param  bweight is the value of the bandwidth morphing function.
+  //! \param  morphed is an array of (at least) size() Breakpoints to
+  //!         fill with the morphed parameters.
+  void morph(const Breakpoint *src, const Breakpoint *tgt, double fweight,
+             double aweight, double bweight, Breakpoint *morphed) const;
+
+  //  -- access --
+
+  //! Return the number of morphed Partials.
+  size_type size(void) const { return m_labels.size(); }
+
+  //! Return the label of the kth morphed Partial (0 for faded
+  //! unlabeled Partials).
+  Partial::label_type label(size_type k) const { return m_labels[k]; }
+
+  //! Return the shaping parameter for the amplitude morphing
+  //! function (see Morpher::amplitudeShape).
+  double amplitudeShape(void) const { return m_logMorphShape; }
+
+  //! Set the shaping parameter for the amplitude morphing
+  //! function (see Morpher::setAmplitudeShape).
+  //!
+  //! \throw  InvalidArgument if x is not positive.
+  void setAmplitudeShape(double x);
+
+  //! Enable (or disable) log-domain amplitude and bandwidth morphing.
+  void enableLogAmpMorphing(bool enable = true) { m_doLogAmpMorphing = enable; }
+
+  //! Enable (or disable) log-domain frequency morphing.
+  void enableLogFreqMorphing(bool enable = true) {
+    m_doLogFreqMorphing = enable;
+  }
+
+  //  -- instance variables --
+private:
+  //  correspondence table, one entry per morphed Partial
+  //  in each group, holding source and target indices and
+  //  the index of the morphed Partial:
+  std::vector<size_type> m_morphSrc, m_morphTgt, m_morphOut;
+  std::vector<size_type> m_fadeSrc, m_fadeSrcOut;
+  std::vector<size_type> m_fadeTgt, m_fadeTgtOut;
+
+  std::vector<Partial::label_type> m_labels; //  labels of morphed Partials
+
+  double m_logMorphShape;   //  shaping parameter for log amplitude morphing
+  bool m_doLogAmpMorphing;  //  morph amplitude and bandwidth in log domain
+  bool m_doLogFreqMorphing; //  morph frequency in log domain
+
+}; //  end of class RealtimeMorpher
+
+} //  end of namespace Loris
+
+#endif /* ndef INCLUDE_REALTIMEMORPHER_H */
@@ -0,0 +1,141 @@
+#ifndef INCLUDE_SAMPLEDENVELOPE_H
+#define INCLUDE_SAMPLEDENVELOPE_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * SampledEnvelope.h
+ *
+ * Definition of class SampledEnvelope, an Envelope sampled on a
+ * uniform time grid for constant-time evaluation.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#include "Envelope.h"
+
+#include <vector>
+
+//  begin namespace
+namespace Loris {
+
+// ---------------------------------------------------------------------------
+//  class SampledEnvelope
+//
+//! A SampledEnvelope is a "compiled" form of another Envelope, sampled
+//! at uniformly-spaced times over a finite span and linearly interpolated
+//! between samples. Evaluating a SampledEnvelope costs constant time,
+//! regardless of the complexity of the Envelope from which it was
+//! sampled, so it is a good substitute for an Envelope that is evaluated
+//! very many times, for example once per Breakpoint in a large collection
+//! of Partials.
+//!
+//! Like LinearEnvelope, a SampledEnvelope extends infinitely at each
+//! end (evaluating it outside the sampled span yields the value of the
+//! nearest sample). Between samples, the value is only an approximation
+//! to the original Envelope, so the sampling interval should be short
+//! compared to the time scale of the original Envelope's variation.
+//!
+//! SampledEnvelope implements the Envelope interface, described
+//! by the abstract class Envelope.
+//
+class SampledEnvelope : public Envelope {
+  //  -- public interface --
+public:
+  //  -- construction --
+
+  //! Construct a new SampledEnvelope by sampling another Envelope
+  //! at uniformly-spaced times from tbegin to (at least) tend.
+  //!
+  //! \param  env is the Envelope to sample.
+  //! \param  tbegin is the time of the first sample.
+  //! \param  tend is the time of the last sample (rounded up to the
+  //!         next multiple of the sampling interval).
+  //! \param  interval is the (positive) time between samples in seconds.
+  //! \throw  InvalidArgument if interval is not positive, or tend is
+  //!         earlier than tbegin.
+  SampledEnvelope(const Envelope &env, double tbegin, double tend,
+                  double interval);
+
+  //  compiler-generated copy, assignment, and destruction are OK.
+
+  //  -- Envelope interface --
+
+  //! Return an exact copy of this SampledEnvelope
+  //! (polymorphic copy, following the Prototype pattern).
+  virtual SampledEnvelope *clone(void) const;
+
+  //! Return the linearly-interpolated value of this SampledEnvelope
+  //! at the specified time.
+  //!
+  //! \param  t is the time at which to evaluate this SampledEnvelope.
+  virtual double valueAt(double t) const;
+
+  //! Evaluate this SampledEnvelope at each of a sequence of times,
+  //! storing the values in out.
+  //!
+  //! \param  times is an array of n times at which to evaluate this
+  //!         SampledEnvelope.
+  //! \param  out is an array of (at least) n values to fill.
+  //! \param  n is the number of times to evaluate.
+  virtual void valueAt(const double *times, double *out, std::size_t n) const;
+
+  //  -- access --
+
+  //! Return the time of the first sample.
+  double startTime(void) const { return m_start; }
+
+  //! Return the time between samples, in seconds.
+  double interval(void) const { return 1. / m_rate; }
+
+  //! Return the number of samples.
+  std::size_t size(void) const { return m_samples.size(); }
+
+  //  -- private helpers --
+private:
+  double interpolate(double t) const {
+    const double x = (t - m_start) * m_rate;
+    if (!(x > 0.)) {
+      return m_samples.front();
+    }
+    const std::size_t idx = static_cast<std::size_t>(x);
+    if (idx + 1 >= m_samples.size()) {
+      return m_samples.back();
+    }
+    const double alpha = x - idx;
+    return m_samples[idx] + alpha * (m_samples[idx + 1] - m_samples[idx]);
+  }
+
+  //  -- instance variables --
+
+  std::vector<double> m_samples; //  envelope values on the time grid
+  double m_start;                //  time of the first sample
+  double m_rate;                 //  samples per second (reciprocal of the
+                                 //  sampling interval)
+
+}; //  end of class SampledEnvelope
+
+} //  end of namespace Loris
+
+#endif /* ndef INCLUDE_SAMPLEDENVELOPE_H */
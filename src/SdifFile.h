@@ -22,7 +22,8 @@
  *
  * SdifFile.h
  *
- * Definition of SdifFile class for Partial import and export in Loris.
+ * Definition of SdifFile class for Partial import and export in Loris,
+ * and of SdifFrameReader, for reading SDIF envelope data frame by frame.
  *
  * Kelly Fitz, 8 Jan 2003
  * loris@cerlsoundgroup.org
@@ -35,6 +36,7 @@
 #include "Partial.h"
 #include "PartialList.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -237,4 +239,103 @@ inline void SdifFile::addPartials(PartialList::const_iterator begin_partials,
   partials_.insert(partials_.end(), begin_partials, end_partials);
 }
 
+// ---------------------------------------------------------------------------
+//	class SdifFrameReader
+//
+//!	Class SdifFrameReader reads the envelope (RBEP or 1TRC) frames in a
+//!	SDIF file one at a time, without building Partials. Each frame
+//!	yields a row for each Breakpoint it describes, identified by the
+//!	SDIF Partial index. Rows from 7-column 1TRC matrices that are marked
+//!	as resampled are skipped, as they are by SdifFile.
+//!
+//!	The file is mapped into memory and decoded in place, so a reader
+//!	uses a small, constant amount of memory, and opening a large file
+//!	does not require reading it. Labels (RBEL) and markers (RBEM)
+//!	that precede the envelope data are read when the reader is
+//!	constructed.
+//!
+//!	SdifFrameReader cannot be copied.
+//
+class SdifFrameReader {
+  //	-- public interface --
+public:
+  //	-- types --
+
+  //! A Breakpoint read from an envelope frame: the SDIF Partial index,
+  //! the exact time of the Breakpoint, and its parameters.
+  struct Row {
+    long index;
+    double time;
+    Breakpoint breakpoint;
+  };
+
+  //! The type of the row storage in an SdifFrameReader.
+  typedef std::vector<Row> rows_type;
+
+  //! The type of marker storage in an SdifFrameReader.
+  typedef SdifFile::markers_type markers_type;
+
+  //	-- construction --
+
+  //! Initialize an instance of SdifFrameReader for the SDIF file having
+  //! the specified filename or path, positioned before the first envelope
+  //! frame.
+  //!
+  //! \throw FileIOException if the file cannot be opened, or is not
+  //!        an SDIF file.
+  explicit SdifFrameReader(const std::string &filename);
+
+  //! Destroy this SdifFrameReader, unmapping the file.
+  ~SdifFrameReader(void);
+
+  //	-- reading --
+
+  //! Read the next envelope frame, and return true, or return false
+  //! if there are no more envelope frames in the file. Labels and
+  //! markers found along the way are also read.
+  //!
+  //! \throw FileIOException if the frame is damaged.
+  bool nextFrame(void);
+
+  //! Return the time of the frame most recently read by nextFrame.
+  double frameTime(void) const;
+
+  //! Return the rows in the frame most recently read by nextFrame,
+  //! in the order they are stored in the file. Only valid until the
+  //! next call to nextFrame, seek, or rewind.
+  const rows_type &rows(void) const;
+
+  //! Return the label for the Partial having the specified SDIF index,
+  //! or 0 if no label has been read for that index.
+  Partial::label_type label(long index) const;
+
+  //! Return the Markers read so far (usually all of them, since Loris
+  //! writes markers before the envelope data).
+  const markers_type &markers(void) const;
+
+  //	-- positioning --
+
+  //! Position the reader so that the next frame read is the last
+  //! envelope frame at or before the specified time (or the first
+  //! frame, if the time is earlier than all frames), so that the
+  //! rows of the next frame include the Breakpoints at that time.
+  //!
+  //! The first seek builds an index of frame times and offsets by
+  //! scanning the frame and matrix headers.
+  void seek(double time);
+
+  //! Position the reader before the first envelope frame.
+  void rewind(void);
+
+private:
+  //	-- implementation --
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+
+  //	not implemented
+  SdifFrameReader(const SdifFrameReader &);
+  SdifFrameReader &operator=(const SdifFrameReader &);
+
+}; //	end of class SdifFrameReader
+
 } // namespace Loris
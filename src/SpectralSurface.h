@@ -53,10 +53,17 @@ namespace Loris {
 //! SpectralSurface represents a smoothed time-frequency surface that
 //! can be used to perform cross-synthesis, the filtering of one sound
 //! by the time-varying spectrum of another.
+//!
+//! The operations that apply the surface keep no state between calls,
+//! so several threads can shape different Partials using the same
+//! surface at once, as long as none of them modifies it.
 //
 class SpectralSurface {
   //	-- public interface --
 public:
+  //! Type used for indexing the surface Partials.
+  typedef std::vector<Partial>::size_type size_type;
+
   //	-- lifecycle --
 
   //! Contsruct a new SpectralSurface from a sequence of distilled
@@ -84,7 +91,7 @@ public:
   //! at the corresponding time and frequency.
   //!
   //! \param  p the Partial to modify
-  void scaleAmplitudes(Partial &p);
+  void scaleAmplitudes(Partial &p) const;
 
   //! Scale the amplitudes of a sequence of Partials
   //! according to the amplitude of the spectral surface
@@ -105,9 +112,10 @@ public:
   //!	must be PartialList::iterators, otherwise they can be any type
   //!	of iterators over a sequence of Partials.
 #if !defined(NO_TEMPLATE_MEMBERS)
-  template <typename Iter> void scaleAmplitudes(Iter b, Iter e);
+  template <typename Iter> void scaleAmplitudes(Iter b, Iter e) const;
 #else
-  inline void scaleAmplitudes(PartialList::iterator b, PartialList::iterator e);
+  inline void scaleAmplitudes(PartialList::iterator b,
+                              PartialList::iterator e) const;
 #endif
 
   //! Set the amplitude of every Breakpoint in a Partial
@@ -115,7 +123,7 @@ public:
   //! at the corresponding time and frequency.
   //!
   //! \param  p the Partial to modify
-  void setAmplitudes(Partial &p);
+  void setAmplitudes(Partial &p) const;
 
   //! Set the amplitudes of a sequence of Partials
   //! equal to the amplitude of the spectral surface
@@ -138,11 +146,58 @@ public:
   //!	must be PartialList::iterators, otherwise they can be any type
   //!	of iterators over a sequence of Partials.
 #if !defined(NO_TEMPLATE_MEMBERS)
-  template <typename Iter> void setAmplitudes(Iter b, Iter e);
+  template <typename Iter> void setAmplitudes(Iter b, Iter e) const;
 #else
-  inline void setAmplitudes(PartialList::iterator b, PartialList::iterator e);
+  inline void setAmplitudes(PartialList::iterator b,
+                            PartialList::iterator e) const;
 #endif
 
+  // --- grid precomputation ---
+
+  //! Precompute the (smoothed) amplitude of the surface on a regular
+  //! grid of times and logarithmically-spaced frequencies, spanning the
+  //! surface Partials. After the grid is built, scaleAmplitudes and
+  //! setAmplitudes look up the surface amplitude by bilinear interpolation
+  //! on the grid, which is much faster than evaluating the surface Partials
+  //! at every Breakpoint, particularly when many Partials are shaped by
+  //! the same surface. The grid is computed in the unstretched surface
+  //! coordinates, so it remains valid when the stretch factors (or the
+  //! effect) are changed.
+  //!
+  //! The grid rows are computed in parallel, using as many threads as
+  //! the hardware supports.
+  //!
+  //! If the grid would have more than MaxGridSize points, (for a very
+  //! long surface, or a very fine grid) no grid is built, any existing
+  //! grid is discarded, and the surface Partials are evaluated directly.
+  //!
+  //! \pre    timeInterval and binsPerOctave must be positive
+  //! \param  timeInterval the time (in seconds) between grid rows
+  //!         (default DefaultGridTimeInterval)
+  //! \param  binsPerOctave the number of grid columns per octave
+  //!         (default DefaultGridBinsPerOctave)
+  void buildGrid(double timeInterval = DefaultGridTimeInterval,
+                 int binsPerOctave = DefaultGridBinsPerOctave);
+
+  //! Discard the precomputed grid (if any), so that scaleAmplitudes
+  //! and setAmplitudes evaluate the surface Partials directly.
+  void clearGrid(void);
+
+  //! Return true if the surface amplitude has been precomputed on a grid
+  //! (see buildGrid), and false otherwise.
+  bool hasGrid(void) const;
+
+  //! The default time interval (in seconds) between grid rows (5 ms).
+  static const double DefaultGridTimeInterval;
+
+  //! The default number of grid columns per octave (48, or one every
+  //! quarter tone).
+  static const int DefaultGridBinsPerOctave;
+
+  //! The largest number of grid points (rows times columns) that
+  //! buildGrid will compute (1<<24, or 128 MB of amplitudes).
+  static const size_type MaxGridSize;
+
   // --- access/mutation ---
 
   //! Return the amount of strecthing in the frequency dimension
@@ -215,10 +270,28 @@ private:
                          //! the surface, used for normalizing the surface
                          //! amplitude for scaleAmplitudes
 
+  std::vector<double> mGrid; //! the precomputed surface amplitudes, by rows
+                             //! of equal time, empty if no grid was built
+  double mGridTime0;         //! the time of the first grid row
+  double mGridTimeInterval;  //! the time between grid rows
+  double mGridLogFreq0;      //! log2 of the frequency of the first column
+  int mGridBinsPerOctave;    //! the number of grid columns per octave
+  size_type mGridNumTimes;   //! the number of grid rows
+  size_type mGridNumFreqs;   //! the number of grid columns
+
   // --- private helpers ---
 
   //  helper used by constructor for adding Partials one by one
   void addPartialAux(const Partial &p);
+
+  //  helpers that modify one Partial, starting the search for the
+  //  surface Partials neighboring each Breakpoint at hint
+  void scaleAmplitudes(Partial &p, size_type &hint) const;
+  void setAmplitudes(Partial &p, size_type &hint) const;
+
+  //  return the amplitude of the (unstretched) surface at the
+  //  specified frequency and time
+  double surfaceAmplitudeAt(double f, double t, size_type &hint) const;
 };
 
 // ---------------------------------------------------------------------------
@@ -244,7 +317,9 @@ inline SpectralSurface::SpectralSurface(PartialList::iterator b,
                                         PartialList::iterator e)
     :
 #endif
-      mStretchFreq(1.0), mStretchTime(1.0), mEffect(1.0), mMaxSurfaceAmp(0.0) {
+      mStretchFreq(1.0), mStretchTime(1.0), mEffect(1.0), mMaxSurfaceAmp(0.0),
+      mGridTime0(0.0), mGridTimeInterval(0.0), mGridLogFreq0(0.0),
+      mGridBinsPerOctave(0), mGridNumTimes(0), mGridNumFreqs(0) {
   //  add only labeled Partials:
   while (b != e) {
     if (b->label() != 0) {
@@ -292,14 +367,16 @@ inline SpectralSurface::SpectralSurface(PartialList::iterator b,
 //
 #if !defined(NO_TEMPLATE_MEMBERS)
 template <typename Iter>
-void SpectralSurface::scaleAmplitudes(Iter b, Iter e)
+void SpectralSurface::scaleAmplitudes(Iter b, Iter e) const
 #else
 inline void SpectralSurface::scaleAmplitudes(PartialList::iterator b,
-                                             PartialList::iterator e)
+                                             PartialList::iterator e) const
 #endif
 {
+  //  share the neighbor search cache among all the Partials:
+  size_type hint = 0;
   while (b != e) {
-    scaleAmplitudes(*b);
+    scaleAmplitudes(*b, hint);
     ++b;
   }
 }
@@ -330,14 +407,16 @@ inline void SpectralSurface::scaleAmplitudes(PartialList::iterator b,
 //
 #if !defined(NO_TEMPLATE_MEMBERS)
 template <typename Iter>
-void SpectralSurface::setAmplitudes(Iter b, Iter e)
+void SpectralSurface::setAmplitudes(Iter b, Iter e) const
 #else
 inline void SpectralSurface::setAmplitudes(PartialList::iterator b,
-                                           PartialList::iterator e)
+                                           PartialList::iterator e) const
 #endif
 {
+  //  share the neighbor search cache among all the Partials:
+  size_type hint = 0;
   while (b != e) {
-    setAmplitudes(*b);
+    setAmplitudes(*b, hint);
     ++b;
   }
 }
@@ -0,0 +1,59 @@
+#ifndef INCLUDE_STATSCLOCK_H
+#define INCLUDE_STATSCLOCK_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * StatsClock.h
+ *
+ * The clock used to time the stages of analysis and synthesis for
+ * Analyzer::stats() and Synthesizer::stats(). Used internally.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#include <chrono>
+
+//	begin namespace
+namespace Loris {
+
+typedef std::chrono::steady_clock StatsClock;
+
+// ---------------------------------------------------------------------------
+//	lap
+// ---------------------------------------------------------------------------
+//	Return the time in seconds since the time stored in t, and store
+//	the current time in t, so that successive stages are timed with
+//	one clock read per stage.
+//
+inline double lap(StatsClock::time_point &t) {
+  const StatsClock::time_point now = StatsClock::now();
+  const double dt = std::chrono::duration<double>(now - t).count();
+  t = now;
+  return dt;
+}
+
+} // namespace Loris
+
+#endif /* ndef INCLUDE_STATSCLOCK_H */
@@ -46,6 +46,7 @@
 #include "PartialList.h"
 #include "PartialUtils.h"
 
+#include <algorithm>
 #include <vector>
 
 //	begin namespace
@@ -162,6 +163,22 @@ public:
   //!	Function call operator: same as synthesize( p ).
   void operator()(const Partial &p) { synthesize(p); }
 
+  //!	Synthesize a bandwidth-enhanced sinusoidal Partial, accumulating
+  //!	samples in place into a buffer of bufferSize samples, instead of
+  //!	this Synthesizer's sample buffer. Samples that would fall beyond
+  //!	the end of the buffer are not rendered. Samples that are rendered
+  //!	are the same as they would be in this Synthesizer's sample buffer.
+  //!
+  //! \param  p The Partial to synthesize.
+  //! \param  buffer The samples into which the Partial is rendered.
+  //! \param  bufferSize The number of samples in the buffer.
+  //! \return The number of samples needed to render the entire
+  //!         Partial, including fade out at the end, which may
+  //!         exceed bufferSize.
+  //!	\pre    The partial must have non-negative start time.
+  //!	\throw	InvalidPartial if the Partial has negative start time.
+  unsigned long synthesize(Partial p, double *buffer, unsigned long bufferSize);
+
   //!	Synthesize all Partials on the specified half-open (STL-style) range.
   //!	Null Breakpoints are inserted at either end of the Partial to reduce
   //!	turn-on and turn-off artifacts, as described above. The synthesizer
@@ -189,6 +206,31 @@ public:
                          PartialList::const_iterator end_partials);
 #endif
 
+  //!	Synthesize all Partials on the specified half-open (STL-style) range,
+  //!	accumulating samples in place into a buffer of bufferSize samples,
+  //!	instead of this Synthesizer's sample buffer. Samples that would
+  //!	fall beyond the end of the buffer are not rendered.
+  //!
+  //! \param  begin_partials The beginning of the range of Partials
+  //!         to synthesize.
+  //! \param 	end_partials The end of the range of Partials
+  //!         to synthesize.
+  //! \param  buffer The samples into which the Partials are rendered.
+  //! \param  bufferSize The number of samples in the buffer.
+  //! \return The number of samples needed to render all the Partials,
+  //!         including fade outs, which may exceed bufferSize.
+  //!	\pre    The partials must have non-negative start times.
+  //!	\throw	InvalidPartial if any Partial has negative start time.
+#if !defined(NO_TEMPLATE_MEMBERS)
+  template <typename Iter>
+  unsigned long synthesize(Iter begin_partials, Iter end_partials,
+                           double *buffer, unsigned long bufferSize);
+#else
+  inline unsigned long synthesize(PartialList::const_iterator begin_partials,
+                                  PartialList::const_iterator end_partials,
+                                  double *buffer, unsigned long bufferSize);
+#endif
+
   //!	Function call operator: same as
   //!	synthesize( begin_partials, end_partials ).
 #if !defined(NO_TEMPLATE_MEMBERS)
@@ -237,6 +279,33 @@ public:
   //! filter coefficients.)
   Filter &filter(void);
 
+  //	-- statistics --
+
+  //!	Structure storing the counts and times recorded while rendering
+  //!	Partials. Times are wall clock times in seconds.
+  struct Stats {
+    unsigned long numPartials;    //!  Partials rendered
+    unsigned long numBreakpoints; //!  envelope segments rendered
+    unsigned long numSamples;     //!  samples rendered, summed over Partials
+
+    double prepareTime; //!  checking and quantizing Partials
+    double renderTime;  //!  oscillating
+
+    //!	Initialize all counts and times to zero.
+    Stats(void)
+        : numPartials(0), numBreakpoints(0), numSamples(0), prepareTime(0),
+          renderTime(0) {}
+  };
+
+  //!	Return the counts and times accumulated over all the Partials
+  //!	rendered by this Synthesizer since it was constructed, or since
+  //!	resetStats was called. Recording them costs a few clock reads
+  //!	per Partial, so they are always recorded.
+  const Stats &stats(void) const { return m_stats; }
+
+  //!	Reset all the counts and times in stats() to zero.
+  void resetStats(void) { m_stats = Stats(); }
+
   //	-- parameters structure --
 
   enum { Default_FadeTime_Ms = 1, Default_SampleRate_Hz = 44100 };
@@ -289,6 +358,13 @@ public:
 
   //	-- implementation --
 private:
+  bool prepare(Partial &p) const;
+  unsigned long endSample(const Partial &p) const;
+  void render(const Partial &p, double *buffer, unsigned long bufferSize);
+  bool renderSegment(double *buffer, unsigned long bufferSize,
+                     unsigned long beginSamp, unsigned long endSamp,
+                     const Breakpoint &bp);
+
   Oscillator m_osc; //  the Synthesizer has-a Oscillator that it uses to render
                     //  all the Partials one by one.
 
@@ -299,6 +375,8 @@ private:
   double m_fadeTimeSec; //  Partial fade in/out time in seconds
   double m_srateHz;     //	sample rate in Hz
 
+  Stats m_stats; //  counts and times recorded while rendering
+
 }; //	end of class Synthesizer
 
 // ---------------------------------------------------------------------------
@@ -348,6 +426,36 @@ inline void Synthesizer::synthesize(PartialList::const_iterator begin_partials,
   }
 }
 
+// ---------------------------------------------------------------------------
+//	synthesize
+// ---------------------------------------------------------------------------
+//!	Synthesize all Partials on the specified half-open (STL-style) range,
+//!	accumulating samples in place into a buffer of bufferSize samples,
+//!	instead of this Synthesizer's sample buffer. Samples that would
+//!	fall beyond the end of the buffer are not rendered.
+//!
+//! \return The number of samples needed to render all the Partials,
+//!         including fade outs, which may exceed bufferSize.
+//
+#if !defined(NO_TEMPLATE_MEMBERS)
+template <typename Iter>
+unsigned long Synthesizer::synthesize(Iter begin_partials, Iter end_partials,
+                                      double *buffer, unsigned long bufferSize)
+#else
+inline unsigned long
+Synthesizer::synthesize(PartialList::const_iterator begin_partials,
+                        PartialList::const_iterator end_partials,
+                        double *buffer, unsigned long bufferSize)
+#endif
+{
+  unsigned long needed = 0;
+  while (begin_partials != end_partials) {
+    needed =
+        std::max(needed, synthesize(*(begin_partials++), buffer, bufferSize));
+  }
+  return needed;
+}
+
 // ---------------------------------------------------------------------------
 //	operator()
 // ---------------------------------------------------------------------------
@@ -0,0 +1,132 @@
+#ifndef INCLUDE_TRACE_H
+#define INCLUDE_TRACE_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * Trace.h
+ *
+ * Scoped trace events, recorded per thread and exported as Chrome
+ * trace-event JSON (viewable in chrome://tracing or Perfetto).
+ *
+ * Tracing is compiled into the library only when the preprocessor
+ * macro LORIS_TRACE is defined to a non-zero value (configure with
+ * --enable-trace, or cmake with -DLORIS_TRACE=ON). Otherwise
+ * LORIS_TRACE_SCOPE expands to nothing, and the export functions
+ * write an empty trace.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#include <iosfwd>
+#include <string>
+
+//	begin namespace
+namespace Loris {
+
+namespace Trace {
+
+// ---------------------------------------------------------------------------
+//	class Scope
+//
+//!	A Scope records one complete trace event, spanning its lifetime,
+//!	in a ring buffer belonging to the constructing thread. Recording
+//!	takes no locks: each thread claims a buffer (under a mutex) the
+//!	first time it records an event, and writes only to its own buffer
+//!	after that. When a buffer is full, the oldest events are
+//!	overwritten. When a thread exits, its buffer is reused by the
+//!	next thread to record an event.
+//!
+//!	Use the LORIS_TRACE_SCOPE macro, rather than constructing Scopes
+//!	directly, so that trace events are compiled out when tracing
+//!	is disabled.
+//
+class Scope {
+public:
+  //!	Begin a trace event having the specified name, which must
+  //!	be a string literal (only the pointer is stored).
+  explicit Scope(const char *name);
+
+  //!	End the trace event, and record it.
+  ~Scope(void);
+
+private:
+  const char *m_name;
+  long long m_beginNs; //  nanoseconds since the trace epoch
+
+  //	not implemented:
+  Scope(const Scope &);
+  Scope &operator=(const Scope &);
+};
+
+//	-- export --
+
+//!	Write all the trace events recorded (since the last call to
+//!	clear) by all threads to the specified stream, in the Chrome
+//!	trace-event JSON format. Events are written as complete ("X")
+//!	events, timestamped in microseconds, with a separate track for
+//!	each thread.
+//!
+//!	Events recorded while the trace is being written may be
+//!	written incompletely, so this should be called when no traced
+//!	operations are running.
+void writeChromeJson(std::ostream &os);
+
+//!	Write the trace events, as in writeChromeJson( std::ostream & ),
+//!	to the file having the specified name.
+//!
+//!	\throw  FileIOException if the file cannot be written.
+void writeChromeJson(const std::string &filename);
+
+//!	Discard the trace events recorded so far by all threads.
+void clear(void);
+
+//!	Return the number of trace events that can be held in each
+//!	thread's ring buffer.
+unsigned long bufferCapacity(void);
+
+} // namespace Trace
+
+} // namespace Loris
+
+// ---------------------------------------------------------------------------
+//	LORIS_TRACE_SCOPE
+// ---------------------------------------------------------------------------
+//	Record a trace event, having the specified (string literal) name,
+//	spanning the rest of the enclosing scope.
+//
+//	LORIS_TRACE is defined only when building the library, so use this
+//	only in code compiled into the library, never in inline or template
+//	functions in the installed headers.
+//
+#if defined(LORIS_TRACE) && LORIS_TRACE
+#define LORIS_TRACE_CONCAT_AUX(a, b) a##b
+#define LORIS_TRACE_CONCAT(a, b) LORIS_TRACE_CONCAT_AUX(a, b)
+#define LORIS_TRACE_SCOPE(name)                                                \
+  ::Loris::Trace::Scope LORIS_TRACE_CONCAT(loris_trace_scope_, __LINE__)(name)
+#else
+#define LORIS_TRACE_SCOPE(name) ((void)0)
+#endif
+
+#endif /* ndef INCLUDE_TRACE_H */
@@ -63,10 +63,9 @@
 /* ---------------------------------------------------------------- */
 /*      Types
 /*
-/* The (class) types Breakpoint, LinearEnvelope, Partial, 
-   and PartialList are imported from the Loris namespace.
-   The first three are classes, the latter is a typedef
-   for std::list< Loris::Partial >. 
+/* The (class) types Analyzer, Breakpoint, LinearEnvelope,
+   Morpher, Partial, PartialList, and Synthesizer are imported
+   from the Loris namespace.
  */
 #if defined(__cplusplus)
     //    include std library list header, declaring templates
@@ -76,25 +75,34 @@
     //    declare Loris classes in Loris namespace:
     namespace Loris
     {
+        class Analyzer;
         class Breakpoint;
         class LinearEnvelope;
         class Partial;
         class PartialList;
+        class Morpher;
+        class Synthesizer;
     }
    
    // import those names into the global namespace
+   using Loris::Analyzer;
    using Loris::Breakpoint;
    using Loris::LinearEnvelope;
    using Loris::Partial;
    using Loris::PartialList;
+   using Loris::Morpher;
+   using Loris::Synthesizer;
 #else 
     /* no classes, just declare types and use
       opaque C pointers 
     */
+    typedef struct Analyzer Analyzer;
     typedef struct Breakpoint Breakpoint;
     typedef struct LinearEnvelope LinearEnvelope;
     typedef struct PartialList PartialList;
     typedef struct Partial Partial;
+    typedef struct Morpher Morpher;
+    typedef struct Synthesizer Synthesizer;
 #endif
 
 /*
@@ -289,6 +297,37 @@ double analyzer_getBwConvergenceTolerance( void );
 	method is used or if no bandwidth is computed.
  */
 
+typedef struct
+{
+    unsigned long numFrames;
+    unsigned long numPeaksFound;
+    unsigned long numPeaksRejected;
+    unsigned long numPartialsSpawned;
+    unsigned long numPartialsExtended;
+    unsigned long numBreakpoints;
+    double transformTime;
+    double peakSelectionTime;
+    double thinPeaksTime;
+    double bandwidthTime;
+    double partialBuildingTime;
+    double fixFrequencyTime;
+    double totalTime;
+} AnalyzerStats;
+/*  Counts and times (wall clock seconds) recorded during an analysis:
+    the number of short-time analysis frames, spectral peaks selected, 
+    peaks removed by thinning, Partials begun, peaks appended to 
+    Partials, and Breakpoints in all Partials, and the time spent 
+    computing spectra, selecting peaks, thinning peaks, constructing
+    bandwidth envelopes, forming Partials, correcting frequencies and
+    phases, and the whole analysis. In C++, this is a
+    Loris::Analyzer::Stats.
+ */
+
+void analyzer_getStats( AnalyzerStats * stats );
+/*  Store in stats the counts and times recorded during the most
+    recent analysis performed by the sole Analyzer instance.
+ */
+
 
 /* ---------------------------------------------------------------- */
 /*      LinearEnvelope object interface                                
@@ -354,6 +393,15 @@ void destroyPartialList( PartialList * ptr_this );
 /*  Destroy this PartialList.
  */
  
+void partialList_arraySizes( const PartialList * ptr_this,
+                             unsigned long * numPartials,
+                             unsigned long * numBreakpoints );
+/*  Return, in the (non-null) pointers numPartials and numBreakpoints,
+    the number of Partials in this PartialList and the total number
+    of Breakpoints in all of them, the sizes of the arrays needed by
+    partialList_exportArrays.
+ */
+ 
 void partialList_clear( PartialList * ptr_this );
 /*  Remove (and destroy) all the Partials from this PartialList,
     leaving it empty.
@@ -366,6 +414,49 @@ void partialList_copy( PartialList * ptr_this,
     this PartialList.
  */
  
+void partialList_exportArrays( const PartialList * ptr_this,
+                               unsigned long numPartials,
+                               unsigned long numBreakpoints,
+                               unsigned long * offsets, long * labels,
+                               double * times, double * freqs,
+                               double * amps, double * bws,
+                               double * phases );
+/*  Store all the Partials in this PartialList in caller-allocated
+    arrays. numPartials and numBreakpoints must be the sizes returned
+    by partialList_arraySizes. offsets (numPartials + 1 elements)
+    receives the index of the first Breakpoint of each Partial,
+    followed by numBreakpoints, and labels (numPartials elements) the
+    Partial labels. times, freqs, amps, bws, and phases (numBreakpoints
+    elements each) receive the Breakpoint parameters, in order of
+    increasing time in each Partial. Any array except offsets may be
+    NULL, if it is not needed.
+ */
+ 
+void partialList_importArrays( PartialList * ptr_this,
+                               unsigned long numPartials,
+                               const unsigned long * offsets,
+                               const long * labels,
+                               const double * times, const double * freqs,
+                               const double * amps, const double * bws,
+                               const double * phases );
+/*  Append numPartials new Partials, stored in caller-allocated arrays
+    in the form filled by partialList_exportArrays, to this
+    PartialList. The Breakpoints of Partial k are elements offsets[k]
+    up to (not including) offsets[k+1] of times, freqs, amps, bws, and
+    phases, so offsets has numPartials + 1 elements, and must be
+    non-decreasing. labels, bws, and phases may be NULL, in which case
+    the labels, bandwidths, and phases are zero.
+ */
+ 
+void partialList_indexLabels( PartialList * ptr_this, int enable );
+/*  Enable (if enable is non-zero) or disable (if enable is zero) the
+    index of Partials by label in this PartialList. The index speeds
+    up the label operations (copyLabeled, extractLabeled, and 
+    removeLabeled) on large PartialLists. It is kept current as
+    Partials are added and removed, and rebuilt as needed after
+    their labels are changed.
+ */
+ 
 unsigned long partialList_size( const PartialList * ptr_this );
 /*  Return the number of Partials in this PartialList.
  */
@@ -993,6 +1084,197 @@ double weightedAvgFrequency( const Partial * p );
     has no Breakpoints.
  */
  
+/* ---------------------------------------------------------------- */
+/*      Reentrant analysis, morphing, and synthesis
+/*
+/*  The functions above that analyze using the sole Analyzer
+    instance, or morph using the sole amplitude morphing shape,
+    cannot be used by more than one thread at a time. The
+    functions below operate on Analyzer, Morpher, and Synthesizer
+    objects created and destroyed by the client, and keep no
+    other state, so several threads can analyze, morph, and
+    synthesize at once, provided that no two threads use the
+    same object at the same time.
+ */
+
+void analyze_r( Analyzer * ptr_this, const double * buffer,
+                unsigned int bufferSize, double srate,
+                PartialList * partials );
+/*  Analyze an array of bufferSize (mono) samples at the given sample rate
+    (in Hz) using the specified Analyzer, and append the extracted
+    Partials to the given PartialList.
+ */
+
+Analyzer * createAnalyzer( double resolution, double windowWidth );
+/*  Construct and return a new Analyzer configured with the given
+    frequency resolution (minimum instantaneous frequency difference
+    between Partials) and analysis window main lobe width (between
+    zeros). Return NULL if the Analyzer cannot be constructed.
+    The Analyzer must be destroyed by destroyAnalyzer.
+ */
+
+Analyzer * copyAnalyzer( const Analyzer * ptr_this );
+/*  Construct and return a new Analyzer that is an exact copy of
+    the specified Analyzer. The copy must be destroyed by
+    destroyAnalyzer.
+ */
+
+void destroyAnalyzer( Analyzer * ptr_this );
+/*  Destroy an Analyzer constructed by createAnalyzer or copyAnalyzer.
+ */
+
+void analyzer_configure_r( Analyzer * ptr_this, double resolution,
+                           double windowWidth );
+/*  Configure the specified Analyzer with the given frequency
+    resolution and analysis window main lobe width, as
+    analyzer_configure configures the sole Analyzer instance.
+ */
+
+double analyzer_getAmpFloor_r( const Analyzer * ptr_this );
+double analyzer_getCropTime_r( const Analyzer * ptr_this );
+double analyzer_getFreqDrift_r( const Analyzer * ptr_this );
+double analyzer_getFreqFloor_r( const Analyzer * ptr_this );
+double analyzer_getFreqResolution_r( const Analyzer * ptr_this );
+double analyzer_getHopTime_r( const Analyzer * ptr_this );
+double analyzer_getSidelobeLevel_r( const Analyzer * ptr_this );
+double analyzer_getWindowWidth_r( const Analyzer * ptr_this );
+double analyzer_getBwRegionWidth_r( const Analyzer * ptr_this );
+double analyzer_getBwConvergenceTolerance_r( const Analyzer * ptr_this );
+/*  Return the corresponding parameter of the specified Analyzer,
+    as the functions without the _r suffix return the parameters
+    of the sole Analyzer instance.
+ */
+
+void analyzer_setAmpFloor_r( Analyzer * ptr_this, double x );
+void analyzer_setCropTime_r( Analyzer * ptr_this, double x );
+void analyzer_setFreqDrift_r( Analyzer * ptr_this, double x );
+void analyzer_setFreqFloor_r( Analyzer * ptr_this, double x );
+void analyzer_setFreqResolution_r( Analyzer * ptr_this, double x );
+void analyzer_setHopTime_r( Analyzer * ptr_this, double x );
+void analyzer_setSidelobeLevel_r( Analyzer * ptr_this, double x );
+void analyzer_setWindowWidth_r( Analyzer * ptr_this, double x );
+/*  Set the corresponding parameter of the specified Analyzer,
+    as the functions without the _r suffix set the parameters
+    of the sole Analyzer instance.
+ */
+
+void analyzer_storeResidueBandwidth_r( Analyzer * ptr_this,
+                                       double regionWidth );
+void analyzer_storeConvergenceBandwidth_r( Analyzer * ptr_this,
+                                           double tolerance );
+void analyzer_storeNoBandwidth_r( Analyzer * ptr_this );
+/*  Configure bandwidth envelope construction by the specified
+    Analyzer, as the functions without the _r suffix configure
+    the sole Analyzer instance.
+ */
+
+void analyzer_getStats_r( const Analyzer * ptr_this, AnalyzerStats * stats );
+/*  Store in stats the counts and times recorded during the most
+    recent analysis performed by the specified Analyzer.
+ */
+
+Morpher * createMorpher( const LinearEnvelope * ffreq,
+                         const LinearEnvelope * famp,
+                         const LinearEnvelope * fbw );
+/*  Construct and return a new Morpher using the given frequency,
+    amplitude, and bandwidth (noisiness) morphing envelopes, or
+    NULL if the Morpher cannot be constructed. The Morpher must be
+    destroyed by destroyMorpher.
+ */
+
+void destroyMorpher( Morpher * ptr_this );
+/*  Destroy a Morpher constructed by createMorpher.
+ */
+
+void morph_r( Morpher * ptr_this, const PartialList * src0,
+              const PartialList * src1, PartialList * dst );
+/*  Morph labeled Partials in two PartialLists using the specified
+    Morpher, and append the morphed Partials to the destination
+    PartialList, as morph.
+ */
+
+void morphWithReference_r( Morpher * ptr_this, const PartialList * src0,
+                           const PartialList * src1,
+                           long src0RefLabel, long src1RefLabel,
+                           PartialList * dst );
+/*  Morph labeled Partials in two PartialLists using the specified
+    Morpher and reference Partials, and append the morphed Partials
+    to the destination PartialList, as morphWithReference. A reference
+    label of 0 indicates that no reference Partial should be used for
+    the corresponding morph source.
+ */
+
+void morpher_setAmplitudeShape_r( Morpher * ptr_this, double shape );
+/*  Set the shaping parameter for the amplitude morphing function
+    of the specified Morpher, as morpher_setAmplitudeShape.
+ */
+
+Synthesizer * createSynthesizer( double srate );
+/*  Construct and return a new Synthesizer rendering samples at the
+    given sample rate (in Hz), or NULL if the Synthesizer cannot be
+    constructed. The Synthesizer must be destroyed by
+    destroySynthesizer.
+ */
+
+void destroySynthesizer( Synthesizer * ptr_this );
+/*  Destroy a Synthesizer constructed by createSynthesizer.
+ */
+
+unsigned int synthesize_r( Synthesizer * ptr_this,
+                           const PartialList * partials,
+                           double * buffer, unsigned int bufferSize );
+/*  Synthesize Partials in a PartialList using the specified
+    Synthesizer, and accumulate the samples into a buffer of
+    bufferSize samples. Samples beyond the end of the buffer are
+    discarded. Return the number of samples rendered, which may
+    exceed bufferSize.
+ */
+
+double synthesizer_getFadeTime( const Synthesizer * ptr_this );
+/*  Return the Partial fade time, in seconds, of the specified
+    Synthesizer.
+ */
+
+double synthesizer_getSampleRate( const Synthesizer * ptr_this );
+/*  Return the sample rate, in Hz, of the specified Synthesizer.
+ */
+
+void synthesizer_setFadeTime( Synthesizer * ptr_this, double t );
+/*  Set the Partial fade time, in seconds, of the specified
+    Synthesizer. The fade time must be non-negative.
+ */
+
+void synthesizer_setSampleRate( Synthesizer * ptr_this, double rate );
+/*  Set the sample rate, in Hz, of the specified Synthesizer.
+    The sample rate must be positive.
+ */
+
+typedef struct
+{
+    unsigned long numPartials;
+    unsigned long numBreakpoints;
+    unsigned long numSamples;
+    double prepareTime;
+    double renderTime;
+} SynthesizerStats;
+/*  Counts and times (wall clock seconds) recorded while rendering
+    Partials: the number of Partials, envelope segments, and samples
+    rendered, and the time spent preparing Partials for rendering and
+    oscillating. In C++, this is a Loris::Synthesizer::Stats.
+ */
+
+void synthesizer_getStats( const Synthesizer * ptr_this, 
+                           SynthesizerStats * stats );
+/*  Store in stats the counts and times accumulated over all the
+    Partials rendered by the specified Synthesizer since it was 
+    created, or since synthesizer_resetStats was called.
+ */
+
+void synthesizer_resetStats( Synthesizer * ptr_this );
+/*  Reset the counts and times recorded by the specified Synthesizer
+    to zero.
+ */
+ 
 /* ---------------------------------------------------------------- */
 /*      Notification and exception handlers                            
 /*
@@ -1011,6 +1293,26 @@ void setNotifier( void(*f)(const char *) );
     const char * argument, and returns void.
  */
 
+void setThreadExceptionHandler( void(*f)(const char *) );
+/*  Specify a function to call when reporting exceptions raised
+    in the calling thread, in place of the function specified by
+    setExceptionHandler. Specify NULL to restore the function
+    specified by setExceptionHandler.
+ */
+
+const char * getLastError( void );
+/*  Return the message reporting the most recent exception raised
+    in the calling thread, or NULL if no exception has been raised
+    since the last call to clearLastError. The message remains
+    valid until the next exception is raised in the calling thread,
+    or clearLastError is called.
+ */
+
+void clearLastError( void );
+/*  Forget the most recent exception raised in the calling thread,
+    so that getLastError returns NULL.
+ */
+
 #if defined(__cplusplus)
 }    /* extern "C"     */
 #endif
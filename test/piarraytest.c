@@ -0,0 +1,197 @@
+/*
+ * This is the Loris C++ Class Library, implementing analysis, 
+ * manipulation, and synthesis of digitized sounds using the Reassigned 
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ *	piarraytest.c
+ *
+ *	Test of bulk export and import of PartialLists to and from
+ *	flat arrays using the procedural interface to Loris.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#include "loris.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static void notifyAndHalt( const char * msg )
+{
+   printf( "Loris encountered an error:\n%s\n\n", msg );
+   exit( 1 );
+}
+
+static void quietly( const char * msg )
+{
+}
+
+/* storage for the arrays representing a PartialList */
+typedef struct 
+{
+   unsigned long numPartials, numBreakpoints;
+   unsigned long * offsets;
+   long * labels;
+   double * times, * freqs, * amps, * bws, * phases;
+} Arrays;
+
+static void exportArrays( const PartialList * partials, Arrays * a )
+{
+   partialList_arraySizes( partials, &a->numPartials, &a->numBreakpoints );
+   a->offsets = malloc( ( a->numPartials + 1 ) * sizeof( unsigned long ) );
+   a->labels = malloc( a->numPartials * sizeof( long ) );
+   a->times = malloc( a->numBreakpoints * sizeof( double ) );
+   a->freqs = malloc( a->numBreakpoints * sizeof( double ) );
+   a->amps = malloc( a->numBreakpoints * sizeof( double ) );
+   a->bws = malloc( a->numBreakpoints * sizeof( double ) );
+   a->phases = malloc( a->numBreakpoints * sizeof( double ) );
+   partialList_exportArrays( partials, a->numPartials, a->numBreakpoints,
+                             a->offsets, a->labels, a->times, a->freqs, 
+                             a->amps, a->bws, a->phases );
+}
+
+static void freeArrays( Arrays * a )
+{
+   free( a->offsets ); free( a->labels ); free( a->times ); 
+   free( a->freqs ); free( a->amps ); free( a->bws ); free( a->phases );
+}
+
+static int sameArrays( const Arrays * a, const Arrays * b )
+{
+   unsigned long k;
+   if ( a->numPartials != b->numPartials || 
+        a->numBreakpoints != b->numBreakpoints )
+   {
+      return 0;
+   }
+   for ( k = 0; k < a->numPartials; ++k )
+   {
+      if ( a->offsets[k] != b->offsets[k] || a->labels[k] != b->labels[k] )
+      {
+         return 0;
+      }
+   }
+   for ( k = 0; k < a->numBreakpoints; ++k )
+   {
+      if ( a->times[k] != b->times[k] || a->freqs[k] != b->freqs[k] ||
+           a->amps[k] != b->amps[k] || a->bws[k] != b->bws[k] ||
+           a->phases[k] != b->phases[k] )
+      {
+         return 0;
+      }
+   }
+   return a->offsets[a->numPartials] == b->offsets[b->numPartials];
+}
+
+int main( void )
+{
+   #define SRATE 22050
+   #define NSAMPS ( SRATE / 2 )
+   static double samples[ NSAMPS ];
+   unsigned long n, k;
+   Arrays a, b;
+   
+   Analyzer * analyzer = createAnalyzer( 180, 360 );
+   PartialList * partials = createPartialList();
+   PartialList * copy = createPartialList();
+   LinearEnvelope * reference = 0;
+   
+   printf( "Loris procedural interface array export and import test.\n\n" );
+   
+   /* halt if something goes wrong */
+   setExceptionHandler( notifyAndHalt );
+   
+   /* analyze and label two harmonics of 220 Hz */
+   for ( n = 0; n < NSAMPS; ++n )
+   {
+      samples[n] = .5 * sin( 2 * M_PI * 220 * n / SRATE ) +
+                   .25 * sin( 2 * M_PI * 440 * n / SRATE );
+   }
+   analyze_r( analyzer, samples, NSAMPS, SRATE, partials );
+   reference = createFreqReference( partials, 200, 240, 50 );
+   channelize( partials, reference, 1 );
+   
+   /* export, import, and export again */
+   exportArrays( partials, &a );
+   printf( "exported %lu partials having %lu breakpoints\n", 
+           a.numPartials, a.numBreakpoints );
+   if ( 0 == a.numPartials || a.offsets[a.numPartials] != a.numBreakpoints )
+   {
+      printf( "export failed!\n" );
+      return 1;
+   }
+   
+   partialList_importArrays( copy, a.numPartials, a.offsets, a.labels, 
+                             a.times, a.freqs, a.amps, a.bws, a.phases );
+   exportArrays( copy, &b );
+   if ( ! sameArrays( &a, &b ) )
+   {
+      printf( "imported partials are not the same as exported partials!\n" );
+      return 1;
+   }
+   freeArrays( &b );
+   
+   /* optional arrays are zero on import */
+   partialList_clear( copy );
+   partialList_importArrays( copy, a.numPartials, a.offsets, 0, 
+                             a.times, a.freqs, a.amps, 0, 0 );
+   exportArrays( copy, &b );
+   for ( k = 0; k < b.numBreakpoints; ++k )
+   {
+      if ( 0 != b.bws[k] || 0 != b.phases[k] || b.freqs[k] != a.freqs[k] )
+      {
+         printf( "import without bandwidths or phases failed!\n" );
+         return 1;
+      }
+   }
+   for ( k = 0; k < b.numPartials; ++k )
+   {
+      if ( 0 != b.labels[k] )
+      {
+         printf( "import without labels failed!\n" );
+         return 1;
+      }
+   }
+   freeArrays( &b );
+   
+   /* sizes that do not match the PartialList are an error */
+   setExceptionHandler( quietly );
+   clearLastError();
+   partialList_exportArrays( partials, a.numPartials, a.numBreakpoints - 1,
+                             a.offsets, 0, 0, 0, 0, 0, 0 );
+   if ( 0 == getLastError() )
+   {
+      printf( "mismatched array sizes were not reported!\n" );
+      return 1;
+   }
+   
+   freeArrays( &a );
+   destroyLinearEnvelope( reference );
+   destroyPartialList( copy );
+   destroyPartialList( partials );
+   destroyAnalyzer( analyzer );
+   
+   printf( "arrays passed all tests.\n" );
+   return 0;
+}